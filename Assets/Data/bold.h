@@ -0,0 +1,3 @@
+// Columns of every character
+// Packed into Assets/bundle.h as "bold" by Tools/bundle.py; not compiled
+const uint8_t boldChars[] = { 0 };
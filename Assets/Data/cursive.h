@@ -0,0 +1,15 @@
+// Columns of every character
+// Packed into Assets/bundle.h as "cursive" by Tools/bundle.py; not compiled
+const uint8_t cursiveChars[] =
+{
+    0x00,                                                                 // Space
+    0x3c, 0x42, 0x41, 0x41, 0x3d, 0x41, 0x40,                             // A
+    0x02, 0x01, 0x7F, 0x02, 0x01, 0x01, 0x7E, 0x01, 0x01, 0x7E, 0x00,     // M
+    0x38, 0x44, 0x44, 0x3C, 0x40,                                         // a
+    0x40, 0x3A, 0x40,                                                     // i
+    0x40, 0x3F,                                                           // l
+    0x7C, 0x08, 0x04, 0x04, 0x78,                                         // n
+    0x38, 0x44, 0x4C, 0x38,                                               // o
+    0x7C, 0x08, 0x04, 0x04, 0x08,                                         // r
+    0x20, 0x10, 0x4C, 0x70                                                // s
+};
@@ -0,0 +1,123 @@
+// Regular characters scaled 2x to 16 pixels, stored a bank at a time (top bank first)
+// Packed into Assets/bundle.h as "large" by Tools/bundle.py; not compiled
+const uint8_t largeChars[] =
+{
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Space
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // !
+    0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00,  // "
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x30, 0xFF, 0xFF, 0x30, 0x30, 0xFF, 0xFF, 0x30, 0x30, 0x00, 0x00,  // #
+    0x03, 0x03, 0x3F, 0x3F, 0x03, 0x03, 0x3F, 0x3F, 0x03, 0x03, 0x00, 0x00,
+    0x30, 0x30, 0xCC, 0xCC, 0xFF, 0xFF, 0xCC, 0xCC, 0x0C, 0x0C, 0x00, 0x00,  // $
+    0x0C, 0x0C, 0x0C, 0x0C, 0x3F, 0x3F, 0x0C, 0x0C, 0x03, 0x03, 0x00, 0x00,
+    0x0F, 0x0F, 0x0F, 0x0F, 0xC0, 0xC0, 0x30, 0x30, 0x0C, 0x0C, 0x00, 0x00,  // %
+    0x0C, 0x0C, 0x03, 0x03, 0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x00, 0x00,
+    0x3C, 0x3C, 0xC3, 0xC3, 0x33, 0x33, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00,  // &
+    0x0F, 0x0F, 0x30, 0x30, 0x33, 0x33, 0x0C, 0x0C, 0x33, 0x33, 0x00, 0x00,
+    0x00, 0x00, 0x33, 0x33, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0xF0, 0x0C, 0x0C, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,  // (
+    0x00, 0x00, 0x03, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x03, 0x0C, 0x0C, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00,  // )
+    0x00, 0x00, 0x30, 0x30, 0x0C, 0x0C, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x30, 0xC0, 0xC0, 0xFC, 0xFC, 0xC0, 0xC0, 0x30, 0x30, 0x00, 0x00,  // *
+    0x03, 0x03, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xFC, 0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00,  // +
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // ,
+    0x00, 0x00, 0x33, 0x33, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00,  // -
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // .
+    0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x30, 0x30, 0x0C, 0x0C, 0x00, 0x00,  // /
+    0x0C, 0x0C, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0xFC, 0x03, 0x03, 0xC3, 0xC3, 0x33, 0x33, 0xFC, 0xFC, 0x00, 0x00,  // 0
+    0x0F, 0x0F, 0x33, 0x33, 0x30, 0x30, 0x30, 0x30, 0x0F, 0x0F, 0x00, 0x00,
+    0x00, 0x00, 0x0C, 0x0C, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 1
+    0x00, 0x00, 0x30, 0x30, 0x3F, 0x3F, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x0C, 0x0C, 0x03, 0x03, 0x03, 0x03, 0xC3, 0xC3, 0x3C, 0x3C, 0x00, 0x00,  // 2
+    0x30, 0x30, 0x3C, 0x3C, 0x33, 0x33, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00,
+    0x03, 0x03, 0x03, 0x03, 0x33, 0x33, 0xCF, 0xCF, 0x03, 0x03, 0x00, 0x00,  // 3
+    0x0C, 0x0C, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0F, 0x0F, 0x00, 0x00,
+    0xC0, 0xC0, 0x30, 0x30, 0x0C, 0x0C, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,  // 4
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x3F, 0x3F, 0x03, 0x03, 0x00, 0x00,
+    0x3F, 0x3F, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xC3, 0xC3, 0x00, 0x00,  // 5
+    0x0C, 0x0C, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0F, 0x0F, 0x00, 0x00,
+    0xF0, 0xF0, 0xCC, 0xCC, 0xC3, 0xC3, 0xC3, 0xC3, 0x00, 0x00, 0x00, 0x00,  // 6
+    0x0F, 0x0F, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0F, 0x0F, 0x00, 0x00,
+    0x03, 0x03, 0x03, 0x03, 0xC3, 0xC3, 0x33, 0x33, 0x0F, 0x0F, 0x00, 0x00,  // 7
+    0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3C, 0x3C, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x3C, 0x3C, 0x00, 0x00,  // 8
+    0x0F, 0x0F, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0F, 0x0F, 0x00, 0x00,
+    0x3C, 0x3C, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xFC, 0xFC, 0x00, 0x00,  // 9
+    0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x0C, 0x0C, 0x03, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // :
+    0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // ;
+    0x00, 0x00, 0x33, 0x33, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xC0, 0xC0, 0x30, 0x30, 0x0C, 0x0C, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,  // <
+    0x00, 0x00, 0x03, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00,  // =
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC0, 0x00, 0x00,  // >
+    0x00, 0x00, 0x30, 0x30, 0x0C, 0x0C, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x0C, 0x0C, 0x03, 0x03, 0x03, 0x03, 0xC3, 0xC3, 0x3C, 0x3C, 0x00, 0x00,  // ?
+    0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0C, 0x0C, 0xC3, 0xC3, 0xC3, 0xC3, 0x03, 0x03, 0xFC, 0xFC, 0x00, 0x00,  // @
+    0x0F, 0x0F, 0x30, 0x30, 0x3F, 0x3F, 0x30, 0x30, 0x0F, 0x0F, 0x00, 0x00,
+    0xFC, 0xFC, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xFC, 0xFC, 0x00, 0x00,  // A
+    0x3F, 0x3F, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x3F, 0x3F, 0x00, 0x00,
+    0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x3C, 0x3C, 0x00, 0x00,  // B
+    0x3F, 0x3F, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0F, 0x0F, 0x00, 0x00,
+    0xFC, 0xFC, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x0C, 0x0C, 0x00, 0x00,  // C
+    0x0F, 0x0F, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0C, 0x0C, 0x00, 0x00,
+    0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x0C, 0x0C, 0xF0, 0xF0, 0x00, 0x00,  // D
+    0x3F, 0x3F, 0x30, 0x30, 0x30, 0x30, 0x0C, 0x0C, 0x03, 0x03, 0x00, 0x00,
+    0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x03, 0x03, 0x00, 0x00,  // E
+    0x3F, 0x3F, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00,
+    0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x03, 0x03, 0x00, 0x00,  // F
+    0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0xFC, 0x03, 0x03, 0xC3, 0xC3, 0xC3, 0xC3, 0xCC, 0xCC, 0x00, 0x00,  // G
+    0x0F, 0x0F, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3F, 0x3F, 0x00, 0x00,
+    0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0x00, 0x00,  // H
+    0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x03, 0xFF, 0xFF, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,  // I
+    0x00, 0x00, 0x30, 0x30, 0x3F, 0x3F, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0xFF, 0xFF, 0x03, 0x03, 0x00, 0x00,  // J
+    0x0C, 0x0C, 0x30, 0x30, 0x30, 0x30, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xC0, 0xC0, 0x30, 0x30, 0x0C, 0x0C, 0x03, 0x03, 0x00, 0x00,  // K
+    0x3F, 0x3F, 0x00, 0x00, 0x03, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // L
+    0x3F, 0x3F, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00,
+    0xFF, 0xFF, 0x0C, 0x0C, 0xF0, 0xF0, 0x0C, 0x0C, 0xFF, 0xFF, 0x00, 0x00,  // M
+    0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00,
+    0xFF, 0xFF, 0x30, 0x30, 0xC0, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,  // N
+    0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x3F, 0x3F, 0x00, 0x00,
+    0xFC, 0xFC, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xFC, 0xFC, 0x00, 0x00,  // O
+    0x0F, 0x0F, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0F, 0x0F, 0x00, 0x00,
+    0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x3C, 0x3C, 0x00, 0x00,  // P
+    0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0xFC, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xFC, 0xFC, 0x00, 0x00,  // Q
+    0x0F, 0x0F, 0x30, 0x30, 0x33, 0x33, 0x0C, 0x0C, 0x33, 0x33, 0x00, 0x00,
+    0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x3C, 0x3C, 0x00, 0x00,  // R
+    0x3F, 0x3F, 0x00, 0x00, 0x03, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0x00, 0x00,
+    0x3C, 0x3C, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x03, 0x03, 0x00, 0x00,  // S
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0F, 0x0F, 0x00, 0x00,
+    0x03, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00,  // T
+    0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,  // U
+    0x0F, 0x0F, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0F, 0x0F, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,  // V
+    0x03, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0x0C, 0x0C, 0x03, 0x03, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,  // W
+    0x0F, 0x0F, 0x30, 0x30, 0x0F, 0x0F, 0x30, 0x30, 0x0F, 0x0F, 0x00, 0x00,
+    0x0F, 0x0F, 0x30, 0x30, 0xC0, 0xC0, 0x30, 0x30, 0x0F, 0x0F, 0x00, 0x00,  // X
+    0x3C, 0x3C, 0x03, 0x03, 0x00, 0x00, 0x03, 0x03, 0x3C, 0x3C, 0x00, 0x00,
+    0x3F, 0x3F, 0xC0, 0xC0, 0x00, 0x00, 0xC0, 0xC0, 0x3F, 0x3F, 0x00, 0x00,  // Y
+    0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x03, 0x03, 0x03, 0xC3, 0xC3, 0x33, 0x33, 0x0F, 0x0F, 0x00, 0x00,  // Z
+    0x3C, 0x3C, 0x33, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00 
+};
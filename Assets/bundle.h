@@ -0,0 +1,486 @@
+#ifndef ASSET_BUNDLE_H
+#define ASSET_BUNDLE_H
+
+#include <stdint.h>
+
+// Built by Tools/bundle.py; do not edit
+//
+// cursive          0x4B3663D0    47 bytes
+// large            0x4BD02DB4  1416 bytes
+// demoMap          0xB1626590   192 bytes
+// regular          0xB6A81717   570 bytes
+// bold             0xDE96F676     1 bytes
+// demoTiles        0xE7065E73    32 bytes
+// giant            0xF907064E  3186 bytes
+
+// Uncompressed assets are read in place, so keep the word alignment
+#ifdef __TI_COMPILER_VERSION__
+#pragma DATA_ALIGN(assetBundle, 4)
+#endif
+const uint8_t assetBundle[] =
+{
+    0x41, 0x52, 0x43, 0x42, 0x07, 0x00, 0x00, 0x00, 0xD0, 0x63, 0x36, 0x4B,
+    0x5C, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xB4, 0x2D, 0xD0, 0x4B,
+    0x8C, 0x00, 0x00, 0x00, 0x88, 0x05, 0x00, 0x00, 0x90, 0x65, 0x62, 0xB1,
+    0x14, 0x06, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x17, 0x17, 0xA8, 0xB6,
+    0xD4, 0x06, 0x00, 0x00, 0x3A, 0x02, 0x00, 0x00, 0x76, 0xF6, 0x96, 0xDE,
+    0x10, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x73, 0x5E, 0x06, 0xE7,
+    0x14, 0x09, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x4E, 0x06, 0x07, 0xF9,
+    0x34, 0x09, 0x00, 0x00, 0x72, 0x0C, 0x00, 0x00, 0x00, 0x3C, 0x42, 0x41,
+    0x41, 0x3D, 0x41, 0x40, 0x02, 0x01, 0x7F, 0x02, 0x01, 0x01, 0x7E, 0x01,
+    0x01, 0x7E, 0x00, 0x38, 0x44, 0x44, 0x3C, 0x40, 0x40, 0x3A, 0x40, 0x40,
+    0x3F, 0x7C, 0x08, 0x04, 0x04, 0x78, 0x38, 0x44, 0x4C, 0x38, 0x7C, 0x08,
+    0x04, 0x04, 0x08, 0x20, 0x10, 0x4C, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F,
+    0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0xFF, 0xFF,
+    0x30, 0x30, 0xFF, 0xFF, 0x30, 0x30, 0x00, 0x00, 0x03, 0x03, 0x3F, 0x3F,
+    0x03, 0x03, 0x3F, 0x3F, 0x03, 0x03, 0x00, 0x00, 0x30, 0x30, 0xCC, 0xCC,
+    0xFF, 0xFF, 0xCC, 0xCC, 0x0C, 0x0C, 0x00, 0x00, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x3F, 0x3F, 0x0C, 0x0C, 0x03, 0x03, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x0F,
+    0xC0, 0xC0, 0x30, 0x30, 0x0C, 0x0C, 0x00, 0x00, 0x0C, 0x0C, 0x03, 0x03,
+    0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x00, 0x00, 0x3C, 0x3C, 0xC3, 0xC3,
+    0x33, 0x33, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x30, 0x30,
+    0x33, 0x33, 0x0C, 0x0C, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33,
+    0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0,
+    0x0C, 0x0C, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03,
+    0x0C, 0x0C, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03,
+    0x0C, 0x0C, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30,
+    0x0C, 0x0C, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0xC0, 0xC0,
+    0xFC, 0xFC, 0xC0, 0xC0, 0x30, 0x30, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00,
+    0x0F, 0x0F, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0,
+    0xFC, 0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33,
+    0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x3C,
+    0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xC0, 0xC0, 0x30, 0x30, 0x0C, 0x0C, 0x00, 0x00, 0x0C, 0x0C, 0x03, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x03, 0x03,
+    0xC3, 0xC3, 0x33, 0x33, 0xFC, 0xFC, 0x00, 0x00, 0x0F, 0x0F, 0x33, 0x33,
+    0x30, 0x30, 0x30, 0x30, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30,
+    0x3F, 0x3F, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x03, 0x03,
+    0x03, 0x03, 0xC3, 0xC3, 0x3C, 0x3C, 0x00, 0x00, 0x30, 0x30, 0x3C, 0x3C,
+    0x33, 0x33, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03,
+    0x33, 0x33, 0xCF, 0xCF, 0x03, 0x03, 0x00, 0x00, 0x0C, 0x0C, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x0F, 0x0F, 0x00, 0x00, 0xC0, 0xC0, 0x30, 0x30,
+    0x0C, 0x0C, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x3F, 0x3F, 0x03, 0x03, 0x00, 0x00, 0x3F, 0x3F, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0xC3, 0xC3, 0x00, 0x00, 0x0C, 0x0C, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x0F, 0x0F, 0x00, 0x00, 0xF0, 0xF0, 0xCC, 0xCC,
+    0xC3, 0xC3, 0xC3, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x0F, 0x0F, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03,
+    0xC3, 0xC3, 0x33, 0x33, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x3C, 0xC3, 0xC3,
+    0xC3, 0xC3, 0xC3, 0xC3, 0x3C, 0x3C, 0x00, 0x00, 0x0F, 0x0F, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x0F, 0x0F, 0x00, 0x00, 0x3C, 0x3C, 0xC3, 0xC3,
+    0xC3, 0xC3, 0xC3, 0xC3, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30,
+    0x30, 0x30, 0x0C, 0x0C, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x3C,
+    0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x3C,
+    0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33,
+    0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x30, 0x30,
+    0x0C, 0x0C, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03,
+    0x0C, 0x0C, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03,
+    0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30,
+    0x0C, 0x0C, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x03, 0x03,
+    0x03, 0x03, 0xC3, 0xC3, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0xC3, 0xC3,
+    0xC3, 0xC3, 0x03, 0x03, 0xFC, 0xFC, 0x00, 0x00, 0x0F, 0x0F, 0x30, 0x30,
+    0x3F, 0x3F, 0x30, 0x30, 0x0F, 0x0F, 0x00, 0x00, 0xFC, 0xFC, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0xFC, 0xFC, 0x00, 0x00, 0x3F, 0x3F, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x3F, 0x3F, 0x00, 0x00, 0xFF, 0xFF, 0xC3, 0xC3,
+    0xC3, 0xC3, 0xC3, 0xC3, 0x3C, 0x3C, 0x00, 0x00, 0x3F, 0x3F, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x0F, 0x0F, 0x00, 0x00, 0xFC, 0xFC, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x0C, 0x0C, 0x00, 0x00, 0x0F, 0x0F, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x0C, 0x0C, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0x03,
+    0x03, 0x03, 0x0C, 0x0C, 0xF0, 0xF0, 0x00, 0x00, 0x3F, 0x3F, 0x30, 0x30,
+    0x30, 0x30, 0x0C, 0x0C, 0x03, 0x03, 0x00, 0x00, 0xFF, 0xFF, 0xC3, 0xC3,
+    0xC3, 0xC3, 0xC3, 0xC3, 0x03, 0x03, 0x00, 0x00, 0x3F, 0x3F, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0xFF, 0xFF, 0xC3, 0xC3,
+    0xC3, 0xC3, 0xC3, 0xC3, 0x03, 0x03, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x03, 0x03,
+    0xC3, 0xC3, 0xC3, 0xC3, 0xCC, 0xCC, 0x00, 0x00, 0x0F, 0x0F, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x3F, 0x3F, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xC0,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03,
+    0xFF, 0xFF, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30,
+    0x3F, 0x3F, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x03, 0xFF, 0xFF, 0x03, 0x03, 0x00, 0x00, 0x0C, 0x0C, 0x30, 0x30,
+    0x30, 0x30, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xC0,
+    0x30, 0x30, 0x0C, 0x0C, 0x03, 0x03, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00,
+    0x03, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0xFF, 0xFF, 0x0C, 0x0C,
+    0xF0, 0xF0, 0x0C, 0x0C, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0xFF, 0xFF, 0x30, 0x30,
+    0xC0, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x03, 0x3F, 0x3F, 0x00, 0x00, 0xFC, 0xFC, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0xFC, 0xFC, 0x00, 0x00, 0x0F, 0x0F, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x0F, 0x0F, 0x00, 0x00, 0xFF, 0xFF, 0xC3, 0xC3,
+    0xC3, 0xC3, 0xC3, 0xC3, 0x3C, 0x3C, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0xFC, 0xFC, 0x00, 0x00, 0x0F, 0x0F, 0x30, 0x30,
+    0x33, 0x33, 0x0C, 0x0C, 0x33, 0x33, 0x00, 0x00, 0xFF, 0xFF, 0xC3, 0xC3,
+    0xC3, 0xC3, 0xC3, 0xC3, 0x3C, 0x3C, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00,
+    0x03, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0x00, 0x00, 0x3C, 0x3C, 0xC3, 0xC3,
+    0xC3, 0xC3, 0xC3, 0xC3, 0x03, 0x03, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x0F, 0x0F, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03,
+    0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0x0F, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x0F, 0x0F, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0x03, 0x0C, 0x0C,
+    0x30, 0x30, 0x0C, 0x0C, 0x03, 0x03, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0xC0, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0x0F, 0x30, 0x30,
+    0x0F, 0x0F, 0x30, 0x30, 0x0F, 0x0F, 0x00, 0x00, 0x0F, 0x0F, 0x30, 0x30,
+    0xC0, 0xC0, 0x30, 0x30, 0x0F, 0x0F, 0x00, 0x00, 0x3C, 0x3C, 0x03, 0x03,
+    0x00, 0x00, 0x03, 0x03, 0x3C, 0x3C, 0x00, 0x00, 0x3F, 0x3F, 0xC0, 0xC0,
+    0x00, 0x00, 0xC0, 0xC0, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03,
+    0xC3, 0xC3, 0x33, 0x33, 0x0F, 0x0F, 0x00, 0x00, 0x3C, 0x3C, 0x33, 0x33,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07,
+    0x00, 0x00, 0x14, 0x7F, 0x14, 0x7F, 0x14, 0x00, 0x24, 0x2A, 0x7F, 0x2A,
+    0x12, 0x00, 0x23, 0x13, 0x08, 0x64, 0x62, 0x00, 0x36, 0x49, 0x55, 0x22,
+    0x50, 0x00, 0x00, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x22, 0x41,
+    0x00, 0x00, 0x00, 0x41, 0x22, 0x1C, 0x00, 0x00, 0x14, 0x08, 0x3E, 0x08,
+    0x14, 0x00, 0x08, 0x08, 0x3E, 0x08, 0x08, 0x00, 0x00, 0x50, 0x30, 0x00,
+    0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x60, 0x60, 0x00,
+    0x00, 0x00, 0x20, 0x10, 0x08, 0x04, 0x02, 0x00, 0x3E, 0x51, 0x49, 0x45,
+    0x3E, 0x00, 0x00, 0x42, 0x7F, 0x40, 0x00, 0x00, 0x42, 0x61, 0x51, 0x49,
+    0x46, 0x00, 0x21, 0x41, 0x45, 0x4B, 0x31, 0x00, 0x18, 0x14, 0x12, 0x7F,
+    0x10, 0x00, 0x27, 0x45, 0x45, 0x45, 0x39, 0x00, 0x3C, 0x4A, 0x49, 0x49,
+    0x30, 0x00, 0x01, 0x71, 0x09, 0x05, 0x03, 0x00, 0x36, 0x49, 0x49, 0x49,
+    0x36, 0x00, 0x06, 0x49, 0x49, 0x29, 0x1E, 0x00, 0x00, 0x36, 0x36, 0x00,
+    0x00, 0x00, 0x00, 0x56, 0x36, 0x00, 0x00, 0x00, 0x08, 0x14, 0x22, 0x41,
+    0x00, 0x00, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x00, 0x41, 0x22, 0x14,
+    0x08, 0x00, 0x02, 0x01, 0x51, 0x09, 0x06, 0x00, 0x32, 0x49, 0x79, 0x41,
+    0x3E, 0x00, 0x7E, 0x11, 0x11, 0x11, 0x7E, 0x00, 0x7F, 0x49, 0x49, 0x49,
+    0x36, 0x00, 0x3E, 0x41, 0x41, 0x41, 0x22, 0x00, 0x7F, 0x41, 0x41, 0x22,
+    0x1C, 0x00, 0x7F, 0x49, 0x49, 0x49, 0x41, 0x00, 0x7F, 0x09, 0x09, 0x09,
+    0x01, 0x00, 0x3E, 0x41, 0x49, 0x49, 0x7A, 0x00, 0x7F, 0x08, 0x08, 0x08,
+    0x7F, 0x00, 0x00, 0x41, 0x7F, 0x41, 0x00, 0x00, 0x20, 0x40, 0x41, 0x3F,
+    0x01, 0x00, 0x7F, 0x08, 0x14, 0x22, 0x41, 0x00, 0x7F, 0x40, 0x40, 0x40,
+    0x40, 0x00, 0x7F, 0x02, 0x0C, 0x02, 0x7F, 0x00, 0x7F, 0x04, 0x08, 0x10,
+    0x7F, 0x00, 0x3E, 0x41, 0x41, 0x41, 0x3E, 0x00, 0x7F, 0x09, 0x09, 0x09,
+    0x06, 0x00, 0x3E, 0x41, 0x51, 0x21, 0x5E, 0x00, 0x7F, 0x09, 0x19, 0x29,
+    0x46, 0x00, 0x46, 0x49, 0x49, 0x49, 0x31, 0x00, 0x01, 0x01, 0x7F, 0x01,
+    0x01, 0x00, 0x3F, 0x40, 0x40, 0x40, 0x3F, 0x00, 0x1F, 0x20, 0x40, 0x20,
+    0x1F, 0x00, 0x3F, 0x40, 0x38, 0x40, 0x3F, 0x00, 0x63, 0x14, 0x08, 0x14,
+    0x63, 0x00, 0x07, 0x08, 0x70, 0x08, 0x07, 0x00, 0x61, 0x51, 0x49, 0x45,
+    0x43, 0x00, 0x00, 0x7F, 0x41, 0x41, 0x00, 0x00, 0x02, 0x04, 0x08, 0x10,
+    0x20, 0x00, 0x00, 0x41, 0x41, 0x7F, 0x00, 0x00, 0x04, 0x02, 0x01, 0x02,
+    0x04, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x01, 0x02, 0x04,
+    0x00, 0x00, 0x20, 0x54, 0x54, 0x54, 0x78, 0x00, 0x7F, 0x48, 0x44, 0x44,
+    0x38, 0x00, 0x38, 0x44, 0x44, 0x44, 0x20, 0x00, 0x38, 0x44, 0x44, 0x48,
+    0x7F, 0x00, 0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x08, 0x7E, 0x09, 0x01,
+    0x02, 0x00, 0x0C, 0x52, 0x52, 0x52, 0x3E, 0x00, 0x7F, 0x08, 0x04, 0x04,
+    0x78, 0x00, 0x00, 0x44, 0x7D, 0x40, 0x00, 0x00, 0x20, 0x40, 0x44, 0x3D,
+    0x00, 0x00, 0x7F, 0x10, 0x28, 0x44, 0x00, 0x00, 0x00, 0x41, 0x7F, 0x40,
+    0x00, 0x00, 0x7C, 0x04, 0x18, 0x04, 0x78, 0x00, 0x7C, 0x08, 0x04, 0x04,
+    0x78, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x7C, 0x14, 0x14, 0x14,
+    0x08, 0x00, 0x08, 0x14, 0x14, 0x18, 0x7C, 0x00, 0x7C, 0x08, 0x04, 0x04,
+    0x08, 0x00, 0x48, 0x54, 0x54, 0x54, 0x20, 0x00, 0x04, 0x3F, 0x44, 0x40,
+    0x20, 0x00, 0x3C, 0x40, 0x40, 0x20, 0x7C, 0x00, 0x1C, 0x20, 0x40, 0x20,
+    0x1C, 0x00, 0x3C, 0x40, 0x30, 0x40, 0x3C, 0x00, 0x44, 0x28, 0x10, 0x28,
+    0x44, 0x00, 0x0C, 0x50, 0x50, 0x50, 0x3C, 0x00, 0x44, 0x64, 0x54, 0x4C,
+    0x44, 0x00, 0x00, 0x08, 0x36, 0x41, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
+    0x00, 0x00, 0x00, 0x41, 0x36, 0x08, 0x00, 0x00, 0x10, 0x08, 0x08, 0x10,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x3C, 0x66, 0x66, 0x3C, 0x18, 0x00,
+    0xFF, 0x89, 0x89, 0xFF, 0x91, 0x91, 0x91, 0xFF, 0xFF, 0x81, 0xBD, 0xA5,
+    0xA5, 0xBD, 0x81, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F,
+    0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0,
+    0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0,
+    0xC0, 0x00, 0x00, 0x00, 0x71, 0x71, 0x71, 0xFF, 0xFF, 0xFF, 0x71, 0x71,
+    0x71, 0xFF, 0xFF, 0xFF, 0x71, 0x71, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0x38, 0x38, 0x38, 0xFF, 0xFF,
+    0xFF, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x81, 0x81,
+    0x81, 0x8E, 0x8E, 0x8E, 0xFF, 0xFF, 0xFF, 0x8E, 0x8E, 0x8E, 0x70, 0x70,
+    0x70, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x1F, 0x1F,
+    0x1F, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0x38, 0x38,
+    0x38, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x70, 0x70, 0x70, 0x0E, 0x0E,
+    0x0E, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x03, 0x03,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x1F, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF8, 0x07, 0x07, 0x07, 0xC7, 0xC7,
+    0xC7, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xF1,
+    0xF1, 0x0E, 0x0E, 0x0E, 0x71, 0x71, 0x71, 0x80, 0x80, 0x80, 0x70, 0x70,
+    0x70, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+    0x1C, 0x03, 0x03, 0x03, 0x1C, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xC7, 0xC7, 0xC7, 0x3F, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0x38, 0x38,
+    0x38, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03,
+    0x03, 0x1C, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0x07, 0x07, 0x38, 0x38, 0x38, 0xC0, 0xC0, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80,
+    0x80, 0x7F, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1C, 0x1C, 0x1C, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0xF8,
+    0xF8, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x71, 0x71,
+    0x71, 0x0E, 0x0E, 0x0E, 0xFF, 0xFF, 0xFF, 0x0E, 0x0E, 0x0E, 0x71, 0x71,
+    0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0xFF, 0xFF,
+    0xFF, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x70, 0x70, 0x70, 0xF0, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x03, 0x03,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
+    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0x38, 0x38,
+    0x38, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x70, 0x70, 0x70, 0x0E, 0x0E,
+    0x0E, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF8, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0xC7, 0xC7, 0xC7, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0x70, 0x70, 0x70, 0x0E, 0x0E, 0x0E, 0x01, 0x01, 0x01, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+    0x1C, 0x1C, 0x1C, 0x1C, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x38, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1C, 0x1C, 0x1C, 0x1F, 0x1F, 0x1F, 0x1C, 0x1C, 0x1C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x80, 0x80, 0x70, 0x70, 0x70, 0x0E, 0x0E, 0x0E, 0x01, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x1F, 0x1F, 0x1F, 0x1C, 0x1C,
+    0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0xC7, 0xC7, 0xC7, 0x3F, 0x3F, 0x3F, 0x07, 0x07,
+    0x07, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x0E, 0x0E, 0x0E, 0xF0, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x03, 0x03,
+    0x03, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x03, 0x03,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0x38, 0x38,
+    0x38, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x7E,
+    0x7E, 0x71, 0x71, 0x71, 0x70, 0x70, 0x70, 0xFF, 0xFF, 0xFF, 0x70, 0x70,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x07, 0x07,
+    0x07, 0x00, 0x00, 0x00, 0x81, 0x81, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x03, 0x03,
+    0x03, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x03, 0x03,
+    0x03, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0x38, 0x38, 0x38, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0xF0, 0xF0,
+    0xF0, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+    0x1C, 0x1C, 0x1C, 0x1C, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xC7, 0xC7, 0xC7, 0x3F, 0x3F,
+    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0xF0, 0x0E, 0x0E,
+    0x0E, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF8, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0xF1, 0xF1,
+    0xF1, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0xF1, 0xF1,
+    0xF1, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+    0x1C, 0x1C, 0x1C, 0x1C, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0xF8, 0xF8,
+    0xF8, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xF8, 0xF8,
+    0xF8, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
+    0x0E, 0x8E, 0x8E, 0x8E, 0x7F, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x03, 0x03, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x71, 0x71, 0xF1, 0xF1,
+    0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1C, 0x1C, 0x1C, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0x38, 0x38,
+    0x38, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x0E,
+    0x0E, 0x71, 0x71, 0x71, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03,
+    0x03, 0x1C, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+    0xC0, 0x00, 0x00, 0x00, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
+    0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x38, 0x38,
+    0x38, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x71, 0x71, 0x71, 0x0E, 0x0E,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x03, 0x03,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38,
+    0x38, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xF8, 0xF8,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70,
+    0x70, 0x0E, 0x0E, 0x0E, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0xF0, 0xF0,
+    0xF0, 0x0E, 0x0E, 0x0E, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x1C, 0x1C, 0x1C, 0x1F, 0x1F,
+    0x1F, 0x1C, 0x1C, 0x1C, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0xF8, 0xF8,
+    0xF8, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xF8, 0xF8,
+    0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x70, 0x70, 0x70, 0x70, 0x70,
+    0x70, 0x70, 0x70, 0x70, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0x1F,
+    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F,
+    0x1F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0xF1, 0xF1,
+    0xF1, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+    0x1C, 0x1C, 0x1C, 0x1C, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0xF8, 0xF8,
+    0xF8, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x38, 0x38,
+    0x38, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x03, 0x03,
+    0x03, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x03, 0x03,
+    0x03, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x38, 0x38, 0x38, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x7F, 0x7F,
+    0x7F, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+    0x1C, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
+    0x0E, 0x0E, 0x0E, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F,
+    0x1F, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+    0x1C, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8,
+    0xF8, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x38, 0x38,
+    0x38, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0E, 0x0E,
+    0x0E, 0x0E, 0x0E, 0x0E, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x03, 0x03,
+    0x03, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1F, 0x1F,
+    0x1F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0x07, 0x07, 0xFF, 0xFF, 0xFF, 0x07, 0x07, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1C, 0x1C, 0x1C, 0x1F, 0x1F, 0x1F, 0x1C, 0x1C, 0x1C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07,
+    0x07, 0xFF, 0xFF, 0xFF, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+    0x1C, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0x38, 0x38, 0x38, 0x07, 0x07,
+    0x07, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x0E, 0x0E, 0x0E, 0x71, 0x71,
+    0x71, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F,
+    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x1C, 0x1C,
+    0x1C, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+    0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0x38, 0x38, 0x38, 0xC0, 0xC0, 0xC0, 0x38, 0x38, 0x38, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0x0F,
+    0x0F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0x1F,
+    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F,
+    0x1F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0x01, 0x01, 0x01, 0x0E, 0x0E, 0x0E, 0x70, 0x70, 0x70, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0xF8,
+    0xF8, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xF8, 0xF8,
+    0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0x03,
+    0x03, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x03, 0x03,
+    0x03, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x01, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8,
+    0xF8, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xF8, 0xF8,
+    0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x70, 0x70,
+    0x70, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x03, 0x03,
+    0x03, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x03, 0x03, 0x03, 0x1C, 0x1C,
+    0x1C, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0x0E, 0x0E, 0x0E, 0x7E, 0x7E, 0x7E, 0x8E, 0x8E, 0x8E, 0x01, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x03, 0x03, 0x1C, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0xF8, 0xF8,
+    0xF8, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
+    0x0E, 0x0E, 0x0E, 0x0E, 0xF0, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x1C, 0x1C,
+    0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x03, 0x03,
+    0x03, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xFF, 0xFF,
+    0xFF, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F,
+    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0x03,
+    0x03, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x03, 0x03,
+    0x03, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x7F,
+    0x7F, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x7F, 0x7F,
+    0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x1C, 0x1C,
+    0x1C, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0xFE,
+    0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0x03,
+    0x03, 0x1C, 0x1C, 0x1C, 0x03, 0x03, 0x03, 0x1C, 0x1C, 0x1C, 0x03, 0x03,
+    0x03, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x3F, 0xC0, 0xC0, 0xC0, 0x00, 0x00,
+    0x00, 0xC0, 0xC0, 0xC0, 0x3F, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x80, 0x80,
+    0x80, 0x71, 0x71, 0x71, 0x0E, 0x0E, 0x0E, 0x71, 0x71, 0x71, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x0E, 0x0E, 0x0E, 0xF0, 0xF0,
+    0xF0, 0x0E, 0x0E, 0x0E, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0xC7, 0xC7, 0xC7, 0x3F, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x80, 0x80,
+    0x80, 0x70, 0x70, 0x70, 0x0E, 0x0E, 0x0E, 0x01, 0x01, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+    0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x00, 0x00, 0x00
+};
+
+#endif // ASSET_BUNDLE_H
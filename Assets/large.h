@@ -0,0 +1,61 @@
+#ifndef LARGE_CHARS_COMPRESSED_H
+#define LARGE_CHARS_COMPRESSED_H
+
+#include <stdint.h>
+
+// 1416 bytes compressed to 592 by Tools/compress.py
+const uint8_t largeCharsCompressed[] =
+{
+    0x88, 0x05, 0x99, 0x00, 0x01, 0xFF, 0xFF, 0x87, 0x00, 0x01, 0x33, 0x33,
+    0x85, 0x00, 0x01, 0x3F, 0x3F, 0xC3, 0x03, 0x8B, 0x00, 0x03, 0x30, 0x30,
+    0xFF, 0xFF, 0xC3, 0x03, 0x05, 0x00, 0x00, 0x03, 0x03, 0x3F, 0x3F, 0xC3,
+    0x03, 0xC1, 0x17, 0x09, 0xCC, 0xCC, 0xFF, 0xFF, 0xCC, 0xCC, 0x0C, 0x0C,
+    0x00, 0x00, 0x81, 0x0C, 0x03, 0x3F, 0x3F, 0x0C, 0x0C, 0xC1, 0x17, 0x81,
+    0x0F, 0x03, 0xC0, 0xC0, 0x30, 0x30, 0xC3, 0x17, 0xC1, 0x11, 0x81, 0x3C,
+    0xC1, 0x05, 0x03, 0xC3, 0xC3, 0x33, 0x33, 0xC1, 0x15, 0xC1, 0x23, 0x01,
+    0x30, 0x30, 0xC1, 0x0B, 0xC3, 0x7B, 0x03, 0x33, 0x33, 0x0F, 0x0F, 0x91,
+    0x00, 0x01, 0xF0, 0xF0, 0xC3, 0x3F, 0x81, 0x00, 0x03, 0x03, 0x03, 0x0C,
+    0x0C, 0xC1, 0x81, 0xC5, 0x0B, 0x01, 0xF0, 0xF0, 0xC5, 0x9D, 0xC5, 0x23,
+    0x05, 0x30, 0x30, 0xC0, 0xC0, 0xFC, 0xFC, 0xC1, 0x79, 0xC1, 0x21, 0xC1,
+    0x63, 0xC3, 0x07, 0x81, 0xC0, 0xC1, 0x17, 0x01, 0xC0, 0xC0, 0x83, 0x00,
+    0xD3, 0x6B, 0xC7, 0x83, 0x87, 0xC0, 0x99, 0x00, 0xC3, 0xD3, 0x85, 0x00,
+    0xCB, 0xEF, 0x83, 0x00, 0x03, 0xFC, 0xFC, 0x03, 0x03, 0xC1, 0xF1, 0x01,
+    0xFC, 0xFC, 0xC1, 0x73, 0x01, 0x33, 0x33, 0x81, 0x30, 0xC3, 0x63, 0x03,
+    0x0C, 0x0C, 0xFF, 0xFF, 0x85, 0x00, 0x03, 0x30, 0x30, 0x3F, 0x3F, 0xC3,
+    0xD7, 0xC1, 0x3B, 0xC1, 0x31, 0xC1, 0x57, 0x03, 0x30, 0x30, 0x3C, 0x3C,
+    0xC3, 0x31, 0xC1, 0xC3, 0x05, 0x03, 0x03, 0x33, 0x33, 0xCF, 0xCF, 0xC1,
+    0x59, 0x01, 0x0C, 0x0C, 0x83, 0x30, 0xC1, 0x47, 0xC3, 0x73, 0xC3, 0x49,
+    0x83, 0x03, 0x01, 0x3F, 0x3F, 0xC1, 0x23, 0x01, 0x3F, 0x3F, 0x83, 0x33,
+    0x01, 0xC3, 0xC3, 0xCB, 0x2F, 0x03, 0xF0, 0xF0, 0xCC, 0xCC, 0x81, 0xC3,
+    0x81, 0x00, 0x01, 0x0F, 0x0F, 0xC7, 0x17, 0xC3, 0x75, 0xC5, 0xFF, 0x01,
+    0x3F, 0x3F, 0xC7, 0xE1, 0x83, 0xC3, 0xC1, 0x8F, 0xC9, 0x2F, 0xC5, 0x17,
+    0xC1, 0xD7, 0xC1, 0xA9, 0xC1, 0x85, 0xC3, 0xF5, 0x81, 0x3C, 0x85, 0x00,
+    0x81, 0x0F, 0xC7, 0x49, 0xC7, 0x17, 0xC5, 0x67, 0xC5, 0xBF, 0xC3, 0x39,
+    0xC1, 0x85, 0xC1, 0xAB, 0xC5, 0x51, 0x83, 0x30, 0xC5, 0xD7, 0x81, 0x03,
+    0xC7, 0x23, 0x01, 0xC0, 0xC0, 0xC3, 0x25, 0xC5, 0x3B, 0xC1, 0x07, 0xC1,
+    0xC1, 0xC5, 0x63, 0x01, 0x33, 0x33, 0x83, 0x00, 0x01, 0x0C, 0x0C, 0x81,
+    0xC3, 0x01, 0x03, 0x03, 0xC1, 0xA7, 0xC1, 0xBF, 0x01, 0x3F, 0x3F, 0xC3,
+    0xBF, 0x01, 0xFC, 0xFC, 0x83, 0x03, 0xC1, 0x17, 0x01, 0x3F, 0x3F, 0x83,
+    0x03, 0xC1, 0xF5, 0x01, 0xFF, 0xFF, 0xC7, 0xEF, 0xC1, 0x2B, 0xC5, 0xEF,
+    0xC5, 0x2F, 0x01, 0x0C, 0x0C, 0xC3, 0x47, 0xC3, 0xF1, 0xC1, 0x2F, 0xC3,
+    0x15, 0x01, 0xF0, 0xF0, 0xC5, 0x2F, 0xC3, 0x91, 0xC5, 0x47, 0xC1, 0x0B,
+    0xC5, 0x47, 0xC1, 0xCB, 0xCB, 0x17, 0x87, 0x00, 0xC1, 0x5F, 0x81, 0xC3,
+    0x01, 0xCC, 0xCC, 0xC7, 0x5F, 0xC3, 0x8F, 0x83, 0xC0, 0x01, 0xFF, 0xFF,
+    0xC7, 0x2F, 0xC3, 0x07, 0x01, 0x03, 0x03, 0xC1, 0x7B, 0x83, 0x00, 0xC3,
+    0xD7, 0x85, 0x00, 0xC5, 0x19, 0x01, 0x0C, 0x0C, 0xC5, 0xBD, 0xC3, 0x47,
+    0xC5, 0x9B, 0xC1, 0x3F, 0xC1, 0xB3, 0xC3, 0x8F, 0x87, 0x00, 0xCB, 0xA7,
+    0xC1, 0xD3, 0x01, 0x0C, 0x0C, 0xCD, 0x77, 0x05, 0xFF, 0xFF, 0x30, 0x30,
+    0xC0, 0xC0, 0xC3, 0x37, 0xC5, 0x87, 0xC1, 0x07, 0xC1, 0xBF, 0x81, 0x03,
+    0x01, 0xFC, 0xFC, 0xC7, 0xBF, 0xC1, 0x79, 0xC5, 0xEF, 0x01, 0x3C, 0x3C,
+    0xCF, 0xEF, 0xC9, 0x2F, 0x05, 0x33, 0x33, 0x0C, 0x0C, 0x33, 0x33, 0xCF,
+    0x2F, 0xC5, 0xA7, 0x01, 0x3C, 0x3C, 0x83, 0xC3, 0xC1, 0xBF, 0x85, 0x30,
+    0xC1, 0x5F, 0x81, 0x03, 0xC1, 0xED, 0xC1, 0x17, 0xC5, 0xA3, 0xC3, 0xEF,
+    0xC7, 0x07, 0xCB, 0x8F, 0xC7, 0x17, 0xC3, 0x5B, 0x01, 0x0C, 0x0C, 0xC1,
+    0x3B, 0xC1, 0x0F, 0xC5, 0xD7, 0xC1, 0x2F, 0xC3, 0x03, 0xC3, 0x0B, 0x01,
+    0xC0, 0xC0, 0xC3, 0x0B, 0x01, 0x3C, 0x3C, 0xC1, 0x29, 0x01, 0x03, 0x03,
+    0xC3, 0x9B, 0xC1, 0x2D, 0x01, 0xC0, 0xC0, 0xC5, 0x6F, 0xC5, 0x07, 0x81,
+    0x03, 0x03, 0xC3, 0xC3, 0x33, 0x33, 0xC3, 0x2F, 0x01, 0x33, 0x33, 0x83,
+    0x30, 0x01, 0x00, 0x00
+};
+
+#endif // LARGE_CHARS_COMPRESSED_H
@@ -2,7 +2,15 @@
 #define BOLD_H
 
 #include <stdint.h>
+#include "../lcd.h"
+
+// No characters are defined yet, so everything maps to the empty fallback glyph
+const Glyph boldGlyphs[] = { { 0, 0 } };
+
+// fontPtr is set to the "bold" asset by loadFonts()
+Font boldFont =
+{
+    BOLD, 0, boldGlyphs, ' ', 0, 8
+};
 
-// Size is given first, then the character
-const uint8_t boldChars[] = { 0 };
 #endif // BOLD_H
@@ -2,20 +2,70 @@
 #define CURSIVE_H
 
 #include <stdint.h>
+#include "../lcd.h"
 
-// Size is given first, then the character
-const uint8_t cursiveChars[] =
+// Offset into the columns and width of each character from 'A' to 's'
+// The first entry is the fallback glyph (Space) used for every undefined character
+const Glyph cursiveGlyphs[] =
 {
-    1, 0x00,                                                                 // Space
-    7, 0x3c, 0x42, 0x41, 0x41, 0x3d, 0x41, 0x40,                             // A
-    11, 0x02, 0x01, 0x7F, 0x02, 0x01, 0x01, 0x7E, 0x01, 0x01, 0x7E, 0x00,    // M
-    5, 0x38, 0x44, 0x44, 0x3C, 0x40,                                         // a
-    3, 0x40, 0x3A, 0x40,                                                     // i
-    2, 0x40, 0x3F,                                                           // l
-    5, 0x7C, 0x08, 0x04, 0x04, 0x78,                                         // n
-    4, 0x38, 0x44, 0x4C, 0x38,                                               // o
-    5, 0x7C, 0x08, 0x04, 0x04, 0x08,                                         // r
-    4, 0x20, 0x10, 0x4C, 0x70                                                // s
+    {  0,  1 }, // Fallback (Space)
+    {  1,  7 }, // A
+    {  0,  1 }, // B
+    {  0,  1 }, // C
+    {  0,  1 }, // D
+    {  0,  1 }, // E
+    {  0,  1 }, // F
+    {  0,  1 }, // G
+    {  0,  1 }, // H
+    {  0,  1 }, // I
+    {  0,  1 }, // J
+    {  0,  1 }, // K
+    {  0,  1 }, // L
+    {  8, 11 }, // M
+    {  0,  1 }, // N
+    {  0,  1 }, // O
+    {  0,  1 }, // P
+    {  0,  1 }, // Q
+    {  0,  1 }, // R
+    {  0,  1 }, // S
+    {  0,  1 }, // T
+    {  0,  1 }, // U
+    {  0,  1 }, // V
+    {  0,  1 }, // W
+    {  0,  1 }, // X
+    {  0,  1 }, // Y
+    {  0,  1 }, // Z
+    {  0,  1 }, // [
+    {  0,  1 }, // '\'
+    {  0,  1 }, // ]
+    {  0,  1 }, // ^
+    {  0,  1 }, // _
+    {  0,  1 }, // `
+    { 19,  5 }, // a
+    {  0,  1 }, // b
+    {  0,  1 }, // c
+    {  0,  1 }, // d
+    {  0,  1 }, // e
+    {  0,  1 }, // f
+    {  0,  1 }, // g
+    {  0,  1 }, // h
+    { 24,  3 }, // i
+    {  0,  1 }, // j
+    {  0,  1 }, // k
+    { 27,  2 }, // l
+    {  0,  1 }, // m
+    { 29,  5 }, // n
+    { 34,  4 }, // o
+    {  0,  1 }, // p
+    {  0,  1 }, // q
+    { 38,  5 }, // r
+    { 43,  4 }  // s
+};
+
+// fontPtr is set to the "cursive" asset by loadFonts()
+Font cursiveFont =
+{
+    CURSIVE, 0, cursiveGlyphs, 'A', sizeof(cursiveGlyphs) / sizeof(Glyph) - 1, 8
 };
 
 #endif // CURSIVE_H
@@ -0,0 +1,79 @@
+#ifndef GIANT_H
+#define GIANT_H
+
+#include <stdint.h>
+#include "../lcd.h"
+
+// Offset into the columns and width of each character from ' ' to 'Z'
+// The first entry is the fallback glyph (Space)
+const Glyph giantGlyphs[] =
+{
+    {    0, 18 }, // Fallback (Space)
+    {    0, 18 }, // Space
+    {   54, 18 }, // !
+    {  108, 18 }, // "
+    {  162, 18 }, // #
+    {  216, 18 }, // $
+    {  270, 18 }, // %
+    {  324, 18 }, // &
+    {  378, 18 }, // '
+    {  432, 18 }, // (
+    {  486, 18 }, // )
+    {  540, 18 }, // *
+    {  594, 18 }, // +
+    {  648, 18 }, // ,
+    {  702, 18 }, // -
+    {  756, 18 }, // .
+    {  810, 18 }, // /
+    {  864, 18 }, // 0
+    {  918, 18 }, // 1
+    {  972, 18 }, // 2
+    { 1026, 18 }, // 3
+    { 1080, 18 }, // 4
+    { 1134, 18 }, // 5
+    { 1188, 18 }, // 6
+    { 1242, 18 }, // 7
+    { 1296, 18 }, // 8
+    { 1350, 18 }, // 9
+    { 1404, 18 }, // :
+    { 1458, 18 }, // ;
+    { 1512, 18 }, // <
+    { 1566, 18 }, // =
+    { 1620, 18 }, // >
+    { 1674, 18 }, // ?
+    { 1728, 18 }, // @
+    { 1782, 18 }, // A
+    { 1836, 18 }, // B
+    { 1890, 18 }, // C
+    { 1944, 18 }, // D
+    { 1998, 18 }, // E
+    { 2052, 18 }, // F
+    { 2106, 18 }, // G
+    { 2160, 18 }, // H
+    { 2214, 18 }, // I
+    { 2268, 18 }, // J
+    { 2322, 18 }, // K
+    { 2376, 18 }, // L
+    { 2430, 18 }, // M
+    { 2484, 18 }, // N
+    { 2538, 18 }, // O
+    { 2592, 18 }, // P
+    { 2646, 18 }, // Q
+    { 2700, 18 }, // R
+    { 2754, 18 }, // S
+    { 2808, 18 }, // T
+    { 2862, 18 }, // U
+    { 2916, 18 }, // V
+    { 2970, 18 }, // W
+    { 3024, 18 }, // X
+    { 3078, 18 }, // Y
+    { 3132, 18 }  // Z
+};
+
+// fontPtr is set to the "giant" asset by loadFonts()
+Font giantFont =
+{
+    GIANT, 0, giantGlyphs, ' ', sizeof(giantGlyphs) / sizeof(Glyph) - 1, 24
+};
+
+#endif // GIANT_H
@@ -0,0 +1,79 @@
+#ifndef LARGE_H
+#define LARGE_H
+
+#include <stdint.h>
+#include "../lcd.h"
+
+// Offset into the columns and width of each character from ' ' to 'Z'
+// The first entry is the fallback glyph (Space)
+const Glyph largeGlyphs[] =
+{
+    {    0, 12 }, // Fallback (Space)
+    {    0, 12 }, // Space
+    {   24, 12 }, // !
+    {   48, 12 }, // "
+    {   72, 12 }, // #
+    {   96, 12 }, // $
+    {  120, 12 }, // %
+    {  144, 12 }, // &
+    {  168, 12 }, // '
+    {  192, 12 }, // (
+    {  216, 12 }, // )
+    {  240, 12 }, // *
+    {  264, 12 }, // +
+    {  288, 12 }, // ,
+    {  312, 12 }, // -
+    {  336, 12 }, // .
+    {  360, 12 }, // /
+    {  384, 12 }, // 0
+    {  408, 12 }, // 1
+    {  432, 12 }, // 2
+    {  456, 12 }, // 3
+    {  480, 12 }, // 4
+    {  504, 12 }, // 5
+    {  528, 12 }, // 6
+    {  552, 12 }, // 7
+    {  576, 12 }, // 8
+    {  600, 12 }, // 9
+    {  624, 12 }, // :
+    {  648, 12 }, // ;
+    {  672, 12 }, // <
+    {  696, 12 }, // =
+    {  720, 12 }, // >
+    {  744, 12 }, // ?
+    {  768, 12 }, // @
+    {  792, 12 }, // A
+    {  816, 12 }, // B
+    {  840, 12 }, // C
+    {  864, 12 }, // D
+    {  888, 12 }, // E
+    {  912, 12 }, // F
+    {  936, 12 }, // G
+    {  960, 12 }, // H
+    {  984, 12 }, // I
+    { 1008, 12 }, // J
+    { 1032, 12 }, // K
+    { 1056, 12 }, // L
+    { 1080, 12 }, // M
+    { 1104, 12 }, // N
+    { 1128, 12 }, // O
+    { 1152, 12 }, // P
+    { 1176, 12 }, // Q
+    { 1200, 12 }, // R
+    { 1224, 12 }, // S
+    { 1248, 12 }, // T
+    { 1272, 12 }, // U
+    { 1296, 12 }, // V
+    { 1320, 12 }, // W
+    { 1344, 12 }, // X
+    { 1368, 12 }, // Y
+    { 1392, 12 }  // Z
+};
+
+// fontPtr is set to the "large" asset by loadFonts()
+Font largeFont =
+{
+    LARGE, 0, largeGlyphs, ' ', sizeof(largeGlyphs) / sizeof(Glyph) - 1, 16
+};
+
+#endif // LARGE_H
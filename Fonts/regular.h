@@ -2,7 +2,114 @@
 #define REGULAR_H
 
 #include <stdint.h>
+#include "../lcd.h"
+
+// Offset into the columns and width of each character
+// The first entry is the fallback glyph for characters outside of ' ' to '~'
+const Glyph regularGlyphs[] =
+{
+    {   0, 6 }, // Fallback (Space)
+    {   0, 6 }, // Space
+    {   6, 6 }, // !
+    {  12, 6 }, // "
+    {  18, 6 }, // #
+    {  24, 6 }, // $
+    {  30, 6 }, // %
+    {  36, 6 }, // &
+    {  42, 6 }, // '
+    {  48, 6 }, // (
+    {  54, 6 }, // )
+    {  60, 6 }, // *
+    {  66, 6 }, // +
+    {  72, 6 }, // ,
+    {  78, 6 }, // -
+    {  84, 6 }, // .
+    {  90, 6 }, // /
+    {  96, 6 }, // 0
+    { 102, 6 }, // 1
+    { 108, 6 }, // 2
+    { 114, 6 }, // 3
+    { 120, 6 }, // 4
+    { 126, 6 }, // 5
+    { 132, 6 }, // 6
+    { 138, 6 }, // 7
+    { 144, 6 }, // 8
+    { 150, 6 }, // 9
+    { 156, 6 }, // :
+    { 162, 6 }, // ;
+    { 168, 6 }, // <
+    { 174, 6 }, // =
+    { 180, 6 }, // >
+    { 186, 6 }, // ?
+    { 192, 6 }, // @
+    { 198, 6 }, // A
+    { 204, 6 }, // B
+    { 210, 6 }, // C
+    { 216, 6 }, // D
+    { 222, 6 }, // E
+    { 228, 6 }, // F
+    { 234, 6 }, // G
+    { 240, 6 }, // H
+    { 246, 6 }, // I
+    { 252, 6 }, // J
+    { 258, 6 }, // K
+    { 264, 6 }, // L
+    { 270, 6 }, // M
+    { 276, 6 }, // N
+    { 282, 6 }, // O
+    { 288, 6 }, // P
+    { 294, 6 }, // Q
+    { 300, 6 }, // R
+    { 306, 6 }, // S
+    { 312, 6 }, // T
+    { 318, 6 }, // U
+    { 324, 6 }, // V
+    { 330, 6 }, // W
+    { 336, 6 }, // X
+    { 342, 6 }, // Y
+    { 348, 6 }, // Z
+    { 354, 6 }, // [
+    { 360, 6 }, // '\'
+    { 366, 6 }, // ]
+    { 372, 6 }, // ^
+    { 378, 6 }, // _
+    { 384, 6 }, // `
+    { 390, 6 }, // a
+    { 396, 6 }, // b
+    { 402, 6 }, // c
+    { 408, 6 }, // d
+    { 414, 6 }, // e
+    { 420, 6 }, // f
+    { 426, 6 }, // g
+    { 432, 6 }, // h
+    { 438, 6 }, // i
+    { 444, 6 }, // j
+    { 450, 6 }, // k
+    { 456, 6 }, // l
+    { 462, 6 }, // m
+    { 468, 6 }, // n
+    { 474, 6 }, // o
+    { 480, 6 }, // p
+    { 486, 6 }, // q
+    { 492, 6 }, // r
+    { 498, 6 }, // s
+    { 504, 6 }, // t
+    { 510, 6 }, // u
+    { 516, 6 }, // v
+    { 522, 6 }, // w
+    { 528, 6 }, // x
+    { 534, 6 }, // y
+    { 540, 6 }, // z
+    { 546, 6 }, // {
+    { 552, 6 }, // |
+    { 558, 6 }, // }
+    { 564, 6 }  // ~
+};
+
+// fontPtr is set to the "regular" asset by loadFonts()
+Font regularFont =
+{
+    REGULAR, 0, regularGlyphs, ' ', sizeof(regularGlyphs) / sizeof(Glyph) - 1, 8
+};
 
-// Size is given first, then the character
-const uint8_t regularChars[] = { 0 };
 #endif // REGULAR_H
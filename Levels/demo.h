@@ -0,0 +1,13 @@
+#ifndef DEMO_H
+#define DEMO_H
+
+#include <stdint.h>
+#include "../tilemap.h"
+
+// The tiles are the "demoMap" asset and the tileset "demoTiles", set by loadLevels()
+Level demoLevel =
+{
+    { 0, 32, 6, TILE_SIZE, 2 }, 0
+};
+
+#endif // DEMO_H
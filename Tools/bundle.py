@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+"""
+Packs assets into one blob for bundle.c and writes it as a C header.
+
+    python3 Tools/bundle.py name=file [-z name=file ...] > Assets/bundle.h
+
+A file is taken as raw bytes, or written as file.h:array to read the
+initialiser of a const uint8_t array in a C header (see Assets/Data).
+-z compresses the next asset with Tools/compress.py. Names are looked up on
+the device by their FNV-1a hash, so they cost nothing in flash.
+
+The bundle used by the game is built with:
+
+    python3 Tools/bundle.py \
+        regular=Assets/Data/regular.h:regularChars \
+        cursive=Assets/Data/cursive.h:cursiveChars \
+        bold=Assets/Data/bold.h:boldChars \
+        large=Assets/Data/large.h:largeChars \
+        giant=Assets/Data/giant.h:giantChars \
+        demoMap=Assets/Data/demo.h:demoMap \
+        demoTiles=Assets/Data/demo.h:demoTiles > Assets/bundle.h
+
+Layout (little endian):
+
+    "ARCB", uint16 count, uint16 0
+    count entries sorted by hash:
+        uint32 hash, uint32 offset from the start of the blob,
+        uint16 size, uint8 flags (1: compressed), uint8 0
+    asset data, each asset starting on a 4 byte boundary
+"""
+
+import os
+import re
+import struct
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from compress import compress, decompress  # noqa: E402
+
+MAGIC = b"ARCB"
+COMPRESSED = 1
+
+
+def fnv1a(name):
+    value = 2166136261
+    for byte in name.encode():
+        value = ((value ^ byte) * 16777619) & 0xFFFFFFFF
+    return value
+
+
+def read_array(path, array):
+    """Bytes of the initialiser of const uint8_t array[] in a C header"""
+    with open(path) as f:
+        source = re.sub(r"//[^\n]*|/\*.*?\*/", "", f.read(), flags=re.S)
+    match = re.search(r"\b%s\s*\[\s*\]\s*=\s*\{([^}]*)\}" % re.escape(array), source)
+    if not match:
+        sys.exit("%s has no array %s" % (path, array))
+    return bytes(int(value, 0) for value in match.group(1).split(",") if value.strip())
+
+
+def read_asset(path):
+    if ":" in path:
+        return read_array(*path.rsplit(":", 1))
+    with open(path, "rb") as f:
+        return f.read()
+
+
+def bundle(assets):
+    """assets: list of (name, data, compressed)"""
+    entries = []
+    for name, data, packed in assets:
+        if packed:
+            stored = compress(data)
+            assert decompress(stored) == data
+        else:
+            stored = data
+        if len(stored) > 0xFFFF:
+            sys.exit("%s is larger than 65535 bytes" % name)
+        entries.append((fnv1a(name), name, stored, COMPRESSED if packed else 0))
+
+    entries.sort()
+    for a, b in zip(entries, entries[1:]):
+        if a[0] == b[0]:
+            sys.exit("%s and %s have the same hash; rename one" % (a[1], b[1]))
+
+    offset = 8 + 12 * len(entries)
+    index = bytearray(MAGIC + struct.pack("<HH", len(entries), 0))
+    data = bytearray()
+    for hash_, name, stored, flags in entries:
+        padding = -(offset + len(data)) % 4
+        data.extend(bytes(padding))
+        index.extend(struct.pack("<IIHBB", hash_, offset + len(data), len(stored), flags, 0))
+        data.extend(stored)
+    return bytes(index + data), entries
+
+
+def to_header(blob, entries):
+    lines = ["#ifndef ASSET_BUNDLE_H", "#define ASSET_BUNDLE_H", "",
+             "#include <stdint.h>", "",
+             "// Built by Tools/bundle.py; do not edit", "//"]
+    for hash_, name, stored, flags in entries:
+        lines.append("// %-16s 0x%08X %5d bytes%s" % (name, hash_, len(stored),
+                                                    ", compressed" if flags & COMPRESSED else ""))
+    lines += ["", "// Uncompressed assets are read in place, so keep the word alignment",
+              "#ifdef __TI_COMPILER_VERSION__", "#pragma DATA_ALIGN(assetBundle, 4)", "#endif",
+              "const uint8_t assetBundle[] =", "{"]
+    for row in range(0, len(blob), 12):
+        chunk = blob[row:row + 12]
+        end = "," if row + 12 < len(blob) else ""
+        lines.append("    " + ", ".join("0x%02X" % b for b in chunk) + end)
+    lines += ["};", "", "#endif // ASSET_BUNDLE_H", ""]
+    return "\n".join(lines)
+
+
+def main():
+    assets = []
+    packed = False
+    for arg in sys.argv[1:]:
+        if arg == "-z":
+            packed = True
+            continue
+        if "=" not in arg:
+            sys.exit(__doc__)
+        name, path = arg.split("=", 1)
+        assets.append((name, read_asset(path), packed))
+        packed = False
+    if not assets:
+        sys.exit(__doc__)
+    blob, entries = bundle(assets)
+    sys.stdout.write(to_header(blob, entries))
+
+
+if __name__ == "__main__":
+    main()
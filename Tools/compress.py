@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+"""
+Compresses an asset for decompress() in compress.c and writes it as a C header.
+
+    python3 Tools/compress.py input.bin name > Assets/name.h
+
+The input is raw bytes, usually column-major bank data (an image stored a
+bank at a time, as the fonts are). The output starts with the decompressed
+size (2 bytes, little endian), followed by tokens:
+
+    0x00-0x7F n          n + 1 literal bytes follow
+    0x80-0xBF n b        byte b repeated n - 0x80 + 3 times
+    0xC0-0xFF n d        copy n - 0xC0 + 3 bytes from d + 1 bytes back
+
+Copies may overlap what they write, and a copy from the row's width back
+repeats the bank above, which is where most of the gain on bank data is.
+"""
+
+import sys
+
+MIN_RUN = 3
+MAX_RUN = 0x3F + MIN_RUN
+MAX_LITERALS = 0x80
+MAX_DISTANCE = 0x100
+
+
+def longest_match(data, i):
+    """Longest earlier copy of the bytes at i: (length, distance)."""
+    best = (0, 0)
+    limit = min(MAX_RUN, len(data) - i)
+    for distance in range(1, min(MAX_DISTANCE, i) + 1):
+        length = 0
+        while length < limit and data[i + length - distance] == data[i + length]:
+            length += 1
+        if length > best[0]:
+            best = (length, distance)
+            if length == limit:
+                break
+    return best
+
+
+def compress(data):
+    out = bytearray(len(data).to_bytes(2, "little"))
+    literals = bytearray()
+
+    def flush_literals():
+        while literals:
+            chunk = literals[:MAX_LITERALS]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+            del literals[:MAX_LITERALS]
+
+    i = 0
+    while i < len(data):
+        run = 1
+        while run < MAX_RUN and i + run < len(data) and data[i + run] == data[i]:
+            run += 1
+        length, distance = longest_match(data, i)
+        if max(run, length) < MIN_RUN:
+            literals.append(data[i])
+            i += 1
+            continue
+        flush_literals()
+        if run >= length:
+            out.extend((0x80 + run - MIN_RUN, data[i]))
+            i += run
+        else:
+            out.extend((0xC0 + length - MIN_RUN, distance - 1))
+            i += length
+    flush_literals()
+    return bytes(out)
+
+
+def decompress(packed):
+    """Reference decoder, used to check every compressed asset."""
+    size = int.from_bytes(packed[:2], "little")
+    out = bytearray()
+    i = 2
+    while len(out) < size:
+        token = packed[i]
+        if token < 0x80:
+            out.extend(packed[i + 1:i + 2 + token])
+            i += token + 2
+        elif token < 0xC0:
+            out.extend(packed[i + 1:i + 2] * (token - 0x80 + MIN_RUN))
+            i += 2
+        else:
+            distance = packed[i + 1] + 1
+            for _ in range(token - 0xC0 + MIN_RUN):
+                out.append(out[-distance])
+            i += 2
+    return bytes(out)
+
+
+def to_header(name, data, packed):
+    guard = "".join("_" + c if c.isupper() else c.upper() for c in name) + "_H"
+    lines = ["#ifndef " + guard, "#define " + guard, "", "#include <stdint.h>", "",
+             "// %d bytes compressed to %d by Tools/compress.py" % (len(data), len(packed)),
+             "const uint8_t %s[] =" % name, "{"]
+    for row in range(0, len(packed), 12):
+        chunk = packed[row:row + 12]
+        end = "," if row + 12 < len(packed) else ""
+        lines.append("    " + ", ".join("0x%02X" % b for b in chunk) + end)
+    lines += ["};", "", "#endif // " + guard, ""]
+    return "\n".join(lines)
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit(__doc__)
+    with open(sys.argv[1], "rb") as f:
+        data = f.read()
+    if len(data) > 0xFFFF:
+        sys.exit("assets are limited to 65535 bytes")
+    packed = compress(data)
+    assert decompress(packed) == data
+    sys.stdout.write(to_header(sys.argv[2], data, packed))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,67 @@
+/**
+ * ==================================================================
+ * Animation
+ * ==================================================================
+ *
+ * An animation is a const list of images and how long each is shown.
+ * A player is advanced by the time the last frame took, so animations
+ * run at the same speed whatever the frame rate, skipping frames if a
+ * frame took longer than them.
+ *
+ * The sprite's image is only set when it actually changes, and sprites
+ * only redraw when something about them changes, so an animation frame
+ * that is held costs nothing to draw.
+ *
+ * ==================================================================
+ * ==================================================================
+ */
+
+#include "animation.h"
+
+void playAnimation(AnimationPlayer *player, const Animation *animation,
+                   Sprite *sprite)
+{
+    player->animation = animation;
+    player->sprite = sprite;
+    player->frame = 0;
+    player->finished = 0;
+    player->elapsed = 0;
+    setSpriteImage(sprite, animation->frames[0].image);
+}
+
+void advanceAnimation(AnimationPlayer *player, uint16_t ms)
+{
+    const Animation *animation = player->animation;
+    uint32_t elapsed = player->elapsed + (uint32_t) ms;
+    uint16_t duration;
+
+    if (player->finished)
+    {
+        return;
+    }
+    for (;;)
+    {
+        duration = animation->frames[player->frame].duration;
+        if ((elapsed < duration) || (duration == 0)) // A frame of 0 ms is held for good
+        {
+            break;
+        }
+        elapsed -= duration;
+        if (player->frame + 1 < animation->numOfFrames)
+        {
+            player->frame++;
+        }
+        else if (animation->loop)
+        {
+            player->frame = 0;
+        }
+        else
+        {
+            player->finished = 1;
+            elapsed = 0;
+            break;
+        }
+    }
+    player->elapsed = (uint16_t) elapsed;
+    setSpriteImage(player->sprite, animation->frames[player->frame].image);
+}
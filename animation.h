@@ -0,0 +1,37 @@
+#ifndef ANIMATION_H
+#define ANIMATION_H
+
+#include <stdint.h>
+#include "sprite.h"
+
+/**
+ * ==================================================================
+ * Animation
+ * ==================================================================
+ */
+
+typedef struct AnimationFrames {
+    const SpriteImage *image;
+    uint16_t duration; // Milliseconds
+} AnimationFrame;
+
+typedef struct Animations {
+    const AnimationFrame *frames;
+    uint8_t numOfFrames;
+    uint8_t loop; // 0: stop on the last frame
+} Animation;
+
+typedef struct AnimationPlayers {
+    const Animation *animation;
+    Sprite *sprite;
+    uint8_t frame;
+    uint8_t finished;
+    uint16_t elapsed; // Milliseconds into the frame
+} AnimationPlayer;
+
+/* ================================================================== */
+
+void playAnimation(AnimationPlayer *player, const Animation *animation, Sprite *sprite);
+void advanceAnimation(AnimationPlayer *player, uint16_t ms);
+
+#endif // ANIMATION_H
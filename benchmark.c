@@ -0,0 +1,273 @@
+/**
+ * ==================================================================
+ * Benchmarks
+ * ==================================================================
+ *
+ * Each benchmark runs the same work through a straightforward version and
+ * through the version the game uses, and records both.
+ *
+ * ==================================================================
+ * ==================================================================
+ */
+
+#include "benchmark.h"
+#include "lcd.h"
+#include "text.h"
+#include "timer.h"
+#include "fixed.h"
+#include "draw.h"
+#include "compress.h"
+#include "bundle.h"
+#include "Assets/large.h"
+
+enum
+{
+    BENCHMARK_BODIES = 32, BENCHMARK_STEPS = 16,
+    LARGE_FONT_BYTES = 1416 // largeChars, as decoded from Assets/large.h
+};
+
+BenchmarkResult textRevealBytes;
+BenchmarkResult fixedPointCycles;
+BenchmarkResult drawingCycles;
+BenchmarkResult decodeCycles;
+uint32_t decodeBytesPerSecond;
+uint8_t decodeMatches; // 1 if the decoded font is identical to the original
+
+/**
+ * Bytes sent to animate the logo:
+ * reference clears the display and redraws the whole string at each step
+ */
+void benchmarkTextReveal()
+{
+    char visible[LOGO_NAME_SIZE];
+    TextReveal reveal;
+    uint32_t chars = 0, start;
+    uint8_t i, k, size;
+
+    clearDisplay();
+    start = bytesTransmitted;
+    for (i = 0; i < LOGO_STEPS; i++)
+    {
+        if (i > 0)
+        {
+            clearDisplay();
+        }
+        chars |= logoSteps[i];
+        for (k = 0, size = 0; k < LOGO_NAME_SIZE; k++)
+        {
+            if (chars & (1UL << k))
+            {
+                visible[size++] = logoName[k];
+            }
+        }
+        drawCentredText(2, 4, visible, size, CURSIVE);
+        updateDisplay();
+    }
+    textRevealBytes.reference = bytesTransmitted - start;
+
+    clearDisplay();
+    start = bytesTransmitted;
+    startTextReveal(&reveal, COLS / 2, 2, 4, logoName, LOGO_NAME_SIZE,
+                    CURSIVE, ALIGN_CENTRE);
+    for (i = 0; i < LOGO_STEPS; i++)
+    {
+        revealText(&reveal, logoSteps[i]);
+        updateDisplay();
+    }
+    textRevealBytes.optimised = bytesTransmitted - start;
+}
+
+/**
+ * Bus cycles to step bodies falling and bouncing:
+ * reference uses float, optimised uses Fixed
+ */
+void benchmarkFixedPoint()
+{
+    static float floatY[BENCHMARK_BODIES], floatVY[BENCHMARK_BODIES];
+    static Fixed fixedY[BENCHMARK_BODIES], fixedVY[BENCHMARK_BODIES];
+    const float gravity = 0.25f, bounce = -0.75f;
+    uint32_t start;
+    uint8_t i, step;
+
+    for (i = 0; i < BENCHMARK_BODIES; i++)
+    {
+        floatY[i] = i;
+        floatVY[i] = 0;
+        fixedY[i] = INT_TO_FIXED(i);
+        fixedVY[i] = 0;
+    }
+
+    start = getTime();
+    for (step = 0; step < BENCHMARK_STEPS; step++)
+    {
+        for (i = 0; i < BENCHMARK_BODIES; i++)
+        {
+            floatVY[i] += gravity;
+            floatY[i] += floatVY[i];
+            if (floatY[i] > ROWS - 1)
+            {
+                floatY[i] = ROWS - 1;
+                floatVY[i] *= bounce;
+            }
+        }
+    }
+    fixedPointCycles.reference = getTime() - start;
+
+    start = getTime();
+    for (step = 0; step < BENCHMARK_STEPS; step++)
+    {
+        for (i = 0; i < BENCHMARK_BODIES; i++)
+        {
+            fixedVY[i] = fixedAdd(fixedVY[i], FIXED(0.25));
+            fixedY[i] = fixedAdd(fixedY[i], fixedVY[i]);
+            if (fixedY[i] > INT_TO_FIXED(ROWS - 1))
+            {
+                fixedY[i] = INT_TO_FIXED(ROWS - 1);
+                fixedVY[i] = fixedMul(fixedVY[i], FIXED(-0.75));
+            }
+        }
+    }
+    fixedPointCycles.optimised = getTime() - start;
+}
+
+/**
+ * Plots one pixel with drawPixel, which marks it dirty on its own
+ */
+void plotNaivePixel(int16_t x, int16_t y)
+{
+    if ((x >= 0) && (x < COLS) && (y >= 0) && (y < ROWS))
+    {
+        drawPixel(x, y >> 3, y & 7);
+    }
+}
+
+/**
+ * One pixel per step along the longer axis, dividing to find the other
+ */
+void drawNaiveLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+    int16_t dx = x1 - x0, dy = y1 - y0, steps, i;
+    steps = (dx < 0 ? -dx : dx) > (dy < 0 ? -dy : dy) ? (dx < 0 ? -dx : dx) : (dy < 0 ? -dy : dy);
+    for (i = 0; i <= steps; i++)
+    {
+        plotNaivePixel(x0 + (steps ? dx * i / steps : 0), y0 + (steps ? dy * i / steps : 0));
+    }
+}
+
+/**
+ * Tests every pixel of the bounding box against the radius
+ */
+void drawNaiveCircle(int16_t cx, int16_t cy, int16_t radius)
+{
+    int16_t x, y, distance;
+    for (y = -radius; y <= radius; y++)
+    {
+        for (x = -radius; x <= radius; x++)
+        {
+            distance = x * x + y * y - radius * radius;
+            if ((distance >= -radius) && (distance < radius))
+            {
+                plotNaivePixel(cx + x, cy + y);
+            }
+        }
+    }
+}
+
+/**
+ * Bus cycles to draw a scene of lines, filled rectangles and circles:
+ * reference plots every pixel with drawPixel
+ */
+void benchmarkDrawing()
+{
+    uint32_t start;
+    int16_t i, x, y;
+
+    clearDisplay();
+    start = getTime();
+    for (i = 0; i < 16; i++)
+    {
+        drawNaiveLine(0, i * 3, COLS - 1, ROWS - 1 - i * 3);
+    }
+    for (i = 0; i < 4; i++)
+    {
+        for (y = 4 + i * 10; y < 12 + i * 10; y++)
+        {
+            for (x = i * 20; x < 16 + i * 20; x++)
+            {
+                plotNaivePixel(x, y);
+            }
+        }
+        drawNaiveCircle(10 + i * 20, 24, 5 + i * 4);
+    }
+    updateDisplay();
+    drawingCycles.reference = getTime() - start;
+
+    clearDisplay();
+    start = getTime();
+    for (i = 0; i < 16; i++)
+    {
+        drawLine(0, i * 3, COLS - 1, ROWS - 1 - i * 3);
+    }
+    for (i = 0; i < 4; i++)
+    {
+        fillRect(i * 20, 4 + i * 10, 16, 8);
+        drawCircle(10 + i * 20, 24, 5 + i * 4);
+    }
+    updateDisplay();
+    drawingCycles.optimised = getTime() - start;
+}
+
+/**
+ * Bus cycles to load the large font into RAM:
+ * reference copies it uncompressed from the asset bundle
+ */
+void benchmarkDecompression()
+{
+    static uint8_t decoded[LARGE_FONT_BYTES];
+    AssetHandle large = findAsset("large");
+    const uint8_t *original;
+    uint16_t i, size = getDecompressedSize(largeCharsCompressed);
+    uint32_t start;
+
+    decodeMatches = 0;
+    if ((large == NO_ASSET) || (getAssetSize(large) != size) || (size > sizeof(decoded)))
+    {
+        return;
+    }
+    original = getAssetData(large);
+
+    start = getTime();
+    for (i = 0; i < size; i++)
+    {
+        decoded[i] = original[i];
+    }
+    decodeCycles.reference = getTime() - start;
+
+    for (i = 0; i < size; i++)
+    {
+        decoded[i] = 0;
+    }
+    start = getTime();
+    decompress(largeCharsCompressed, decoded, sizeof(decoded));
+    decodeCycles.optimised = getTime() - start;
+
+    decodeBytesPerSecond = (uint32_t) (((uint64_t) size * CLOCK_HZ)
+            / (decodeCycles.optimised ? decodeCycles.optimised : 1));
+    decodeMatches = 1;
+    for (i = 0; i < size; i++)
+    {
+        if (decoded[i] != original[i])
+        {
+            decodeMatches = 0;
+        }
+    }
+}
+
+void runBenchmarks()
+{
+    benchmarkTextReveal();
+    benchmarkFixedPoint();
+    benchmarkDrawing();
+    benchmarkDecompression();
+    clearDisplay();
+}
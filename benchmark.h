@@ -0,0 +1,35 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <stdint.h>
+
+/**
+ * ==================================================================
+ * Benchmarks
+ * ==================================================================
+ *
+ * Build with BENCHMARK defined to run these after setup.
+ * Results are left in globals to be read from the debugger.
+ */
+
+typedef struct BenchmarkResults {
+    uint32_t reference; // The straightforward implementation
+    uint32_t optimised;
+} BenchmarkResult;
+
+extern BenchmarkResult textRevealBytes;
+extern BenchmarkResult fixedPointCycles;
+extern BenchmarkResult drawingCycles;
+extern BenchmarkResult decodeCycles;
+extern uint32_t decodeBytesPerSecond;
+extern uint8_t decodeMatches;
+
+/* ================================================================== */
+
+void benchmarkTextReveal();
+void benchmarkFixedPoint();
+void benchmarkDrawing();
+void benchmarkDecompression();
+void runBenchmarks();
+
+#endif // BENCHMARK_H
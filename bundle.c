@@ -0,0 +1,141 @@
+/**
+ * ==================================================================
+ * Asset Bundle
+ * ==================================================================
+ *
+ * The bundle is a single const array, so it is linked into flash and
+ * assets are read where they are rather than copied to RAM. Its index
+ * holds the FNV-1a hash of each asset's name, sorted, so an asset is
+ * found with a binary search and no names are stored. Tools/bundle.py
+ * describes the layout.
+ *
+ * Uncompressed assets can be used straight from getAssetData().
+ * Compressed ones are unpacked with loadAsset().
+ *
+ * ==================================================================
+ * ==================================================================
+ */
+
+#include "bundle.h"
+#include "compress.h"
+#include "text.h"
+
+// Rebuild with Tools/bundle.py when assets change
+#include "Assets/bundle.h"
+
+enum
+{
+    BUNDLE_HEADER = 8, INDEX_ENTRY = 12,
+    ASSET_COMPRESSED = (1 << 0)
+};
+
+/**
+ * Little endian fields of the bundle, which need not be aligned
+ */
+static uint16_t readShort(const uint8_t *bytes)
+{
+    return bytes[0] | (bytes[1] << 8);
+}
+
+static uint32_t readWord(const uint8_t *bytes)
+{
+    return readShort(bytes) | ((uint32_t) readShort(bytes + 2) << 16);
+}
+
+/**
+ * Returns 0 for NO_ASSET or any other handle past the end of the index
+ */
+static const uint8_t *getIndexEntry(AssetHandle asset)
+{
+    if (asset >= readShort(assetBundle + 4))
+    {
+        return 0;
+    }
+    return assetBundle + BUNDLE_HEADER + asset * INDEX_ENTRY;
+}
+
+/**
+ * Returns NO_ASSET if the bundle has no asset with the name
+ */
+AssetHandle findAsset(const char name[])
+{
+    uint16_t length = 0, low = 0, high = readShort(assetBundle + 4), middle;
+    uint32_t hash, entry;
+
+    while (name[length])
+    {
+        length++;
+    }
+    hash = hashText(name, length);
+
+    while (low < high)
+    {
+        middle = (low + high) / 2;
+        entry = readWord(getIndexEntry(middle));
+        if (entry == hash)
+        {
+            return middle;
+        }
+        if (entry < hash)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    return NO_ASSET;
+}
+
+/**
+ * Returns 0 for NO_ASSET
+ */
+const uint8_t *getAssetData(AssetHandle asset)
+{
+    const uint8_t *entry = getIndexEntry(asset);
+    return entry ? assetBundle + readWord(entry + 4) : 0;
+}
+
+/**
+ * Bytes stored in the bundle, compressed or not; 0 for NO_ASSET
+ */
+uint16_t getAssetSize(AssetHandle asset)
+{
+    const uint8_t *entry = getIndexEntry(asset);
+    return entry ? readShort(entry + 8) : 0;
+}
+
+uint8_t isAssetCompressed(AssetHandle asset)
+{
+    const uint8_t *entry = getIndexEntry(asset);
+    return entry && (entry[10] & ASSET_COMPRESSED);
+}
+
+/**
+ * Copies or decompresses the asset into dest, up to capacity bytes
+ * Returns the number of bytes written; 0 for NO_ASSET
+ */
+uint16_t loadAsset(AssetHandle asset, uint8_t dest[], uint16_t capacity)
+{
+    const uint8_t *data = getAssetData(asset);
+    uint16_t i, size = getAssetSize(asset);
+
+    if (data == 0)
+    {
+        return 0;
+    }
+    if (isAssetCompressed(asset))
+    {
+        return decompress(data, dest, capacity);
+    }
+    if (size > capacity)
+    {
+        size = capacity;
+    }
+    for (i = 0; i < size; i++)
+    {
+        dest[i] = data[i];
+    }
+    return size;
+}
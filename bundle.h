@@ -0,0 +1,30 @@
+#ifndef BUNDLE_H
+#define BUNDLE_H
+
+#include <stdint.h>
+
+/**
+ * ==================================================================
+ * Asset Bundle
+ * ==================================================================
+ *
+ * Assets are packed into Assets/bundle.h by Tools/bundle.py and looked up
+ * by name. A handle is the asset's place in the bundle's index.
+ */
+
+enum
+{
+    NO_ASSET = 0xFFFF
+};
+
+typedef uint16_t AssetHandle;
+
+/* ================================================================== */
+
+AssetHandle findAsset(const char name[]);
+const uint8_t *getAssetData(AssetHandle asset);
+uint16_t getAssetSize(AssetHandle asset);
+uint8_t isAssetCompressed(AssetHandle asset);
+uint16_t loadAsset(AssetHandle asset, uint8_t dest[], uint16_t capacity);
+
+#endif // BUNDLE_H
@@ -0,0 +1,83 @@
+/**
+ * ==================================================================
+ * Camera
+ * ==================================================================
+ *
+ * Moving the camera passes its position on to whatever draws the world:
+ * the scrolled level (which draws only the columns that come into view,
+ * or all of them again after a vertical move) and the parallax layers
+ * (which merge again only if they moved). Both end up in the frame buffer
+ * through composeLayers(), under the sprites and the HUD.
+ * updateEntities() places sprites relative to the camera and culls the
+ * ones that are off the display, so they cost nothing to render.
+ *
+ * ==================================================================
+ * ==================================================================
+ */
+
+#include "camera.h"
+#include "lcd.h"
+#include "scroll.h"
+#include "layers.h"
+
+Camera camera = { 0, 0, -32768, -32768, 32767, 32767 };
+
+void setCameraBounds(int16_t minX, int16_t minY, int16_t maxX, int16_t maxY)
+{
+    camera.minX = minX;
+    camera.minY = minY;
+    camera.maxX = maxX;
+    camera.maxY = maxY;
+    moveCamera(camera.x, camera.y);
+}
+
+void moveCamera(int16_t x, int16_t y)
+{
+    x = (x < camera.minX) ? camera.minX : (x > camera.maxX) ? camera.maxX : x;
+    y = (y < camera.minY) ? camera.minY : (y > camera.maxY) ? camera.maxY : y;
+    if ((x != camera.x) || (y != camera.y))
+    {
+        camera.x = x;
+        camera.y = y;
+        if (scrollLevel)
+        {
+            scrollTo(x, y);
+        }
+        scrollLayers(x);
+    }
+}
+
+/**
+ * Moves the camera just enough to keep the point CAMERA_MARGIN from the edges
+ */
+void followCamera(int16_t x, int16_t y)
+{
+    int16_t left = camera.x, top = camera.y;
+
+    if (x < camera.x + CAMERA_MARGIN)
+    {
+        left = x - CAMERA_MARGIN;
+    }
+    else if (x >= camera.x + COLS - CAMERA_MARGIN)
+    {
+        left = x - COLS + CAMERA_MARGIN + 1;
+    }
+    if (y < camera.y + CAMERA_MARGIN / 2)
+    {
+        top = y - CAMERA_MARGIN / 2;
+    }
+    else if (y >= camera.y + ROWS - CAMERA_MARGIN / 2)
+    {
+        top = y - ROWS + CAMERA_MARGIN / 2 + 1;
+    }
+    moveCamera(left, top);
+}
+
+/**
+ * Returns 1 if any of the box, in world pixels, is on the display
+ */
+uint8_t isBoxVisible(int16_t x, int16_t y, uint8_t width, uint8_t height)
+{
+    return (x + width > camera.x) && (x < camera.x + COLS)
+            && (y + height > camera.y) && (y < camera.y + ROWS);
+}
@@ -0,0 +1,36 @@
+#ifndef CAMERA_H
+#define CAMERA_H
+
+#include <stdint.h>
+
+/**
+ * ==================================================================
+ * Camera
+ * ==================================================================
+ *
+ * Entities and levels are placed in world pixels. The camera is the
+ * world position of the top left corner of the display. The level follows
+ * it both ways; the parallax layers are backdrops that follow only x and
+ * keep their banks.
+ */
+
+enum
+{
+    CAMERA_MARGIN = 24 // Pixels a followed point can get from the edge before the camera moves
+};
+
+typedef struct Cameras {
+    int16_t x, y;
+    int16_t minX, minY, maxX, maxY; // Range of x and y
+} Camera;
+
+extern Camera camera;
+
+/* ================================================================== */
+
+void setCameraBounds(int16_t minX, int16_t minY, int16_t maxX, int16_t maxY);
+void moveCamera(int16_t x, int16_t y);
+void followCamera(int16_t x, int16_t y);
+uint8_t isBoxVisible(int16_t x, int16_t y, uint8_t width, uint8_t height);
+
+#endif // CAMERA_H
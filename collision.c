@@ -0,0 +1,428 @@
+/**
+ * ==================================================================
+ * Collision
+ * ==================================================================
+ *
+ * Sprites are first tested by their boxes. Only when the boxes overlap are
+ * their pixels compared: each column of the overlap is read from both
+ * sprites as a 32 bit word shifted to the same top row, and the two words
+ * are ANDed. Overlaps taller than 32 rows are compared 32 rows at a time.
+ *
+ * Broad Phase:
+ * The display is split into GRID_CELL_SIZE cells. An object is kept in the
+ * list of the cell holding its top left corner, and is only relinked when it
+ * moves to another cell. As no object is larger than a cell, two objects can
+ * only overlap if their cells are next to each other, so each object is only
+ * compared with the objects in its own cell and four of its neighbours.
+ *
+ * Swept Boxes:
+ * A moving box is tested against tiles and other boxes along its whole move,
+ * so fast objects cannot pass through thin walls. The earliest contact
+ * wins; the box moves up to it, loses the part of its move and velocity
+ * going into the surface, and slides on with the rest. Boxes that already
+ * overlap at the start of a move are ignored rather than pushed apart.
+ *
+ * ==================================================================
+ * ==================================================================
+ */
+
+#include "collision.h"
+
+uint8_t boxesOverlap(int16_t ax, int16_t ay, uint8_t aWidth, uint8_t aHeight,
+                     int16_t bx, int16_t by, uint8_t bWidth, uint8_t bHeight)
+{
+    return (ax < bx + bWidth) && (bx < ax + aWidth) && (ay < by + bHeight)
+            && (by < ay + aHeight);
+}
+
+/**
+ * Returns 32 rows of a column of the sprite, starting at the given row
+ */
+uint32_t getSpriteColumn(const Sprite *sprite, uint8_t column, int16_t row)
+{
+    return getSpriteBits(sprite, column, row)
+            | ((uint32_t) getSpriteBits(sprite, column, row + 8) << 8)
+            | ((uint32_t) getSpriteBits(sprite, column, row + 16) << 16)
+            | ((uint32_t) getSpriteBits(sprite, column, row + 24) << 24);
+}
+
+/**
+ * Returns 1 if a set pixel of one sprite overlaps a set pixel of the other
+ * Hidden sprites never collide
+ */
+uint8_t spritesCollide(const Sprite *a, const Sprite *b, Contact *contact)
+{
+    int16_t left, right, top, bottom, x, y;
+    uint32_t hits;
+
+    if ((a->flags & SPRITE_HIDDEN) || (b->flags & SPRITE_HIDDEN)
+            || !boxesOverlap(a->x, a->y, a->image->width, a->image->height,
+                             b->x, b->y, b->image->width, b->image->height))
+    {
+        return 0;
+    }
+    left = (a->x > b->x) ? a->x : b->x;
+    right = (a->x + a->image->width < b->x + b->image->width) ?
+            a->x + a->image->width : b->x + b->image->width;
+    top = (a->y > b->y) ? a->y : b->y;
+    bottom = (a->y + a->image->height < b->y + b->image->height) ?
+            a->y + a->image->height : b->y + b->image->height;
+
+    for (x = left; x < right; x++)
+    {
+        for (y = top; y < bottom; y += 32)
+        {
+            hits = getSpriteColumn(a, x - a->x, y - a->y)
+                    & getSpriteColumn(b, x - b->x, y - b->y);
+            if (hits)
+            {
+                contact->x = x;
+                contact->y = y;
+                while (!(hits & 1))
+                {
+                    hits >>= 1;
+                    contact->y++;
+                }
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+GridObject gridObjects[MAX_GRID_OBJECTS];
+uint8_t gridCells[GRID_ROWS * GRID_COLS]; // First object in each cell
+uint8_t gridReady;
+
+void clearGrid()
+{
+    uint8_t i;
+    for (i = 0; i < GRID_ROWS * GRID_COLS; i++)
+    {
+        gridCells[i] = GRID_NONE;
+    }
+    for (i = 0; i < MAX_GRID_OBJECTS; i++)
+    {
+        gridObjects[i].cell = GRID_NONE;
+    }
+    gridReady = 1;
+}
+
+/**
+ * Returns the cell holding the point; points off the display use the nearest cell
+ */
+uint8_t getGridCell(int16_t x, int16_t y)
+{
+    int16_t column = (x < 0) ? 0 : x / GRID_CELL_SIZE;
+    int16_t row = (y < 0) ? 0 : y / GRID_CELL_SIZE;
+    if (column >= GRID_COLS)
+    {
+        column = GRID_COLS - 1;
+    }
+    if (row >= GRID_ROWS)
+    {
+        row = GRID_ROWS - 1;
+    }
+    return row * GRID_COLS + column;
+}
+
+void unlinkGridObject(uint8_t id)
+{
+    GridObject *object = &gridObjects[id];
+    if (object->prev != GRID_NONE)
+    {
+        gridObjects[object->prev].next = object->next;
+    }
+    else
+    {
+        gridCells[object->cell] = object->next;
+    }
+    if (object->next != GRID_NONE)
+    {
+        gridObjects[object->next].prev = object->prev;
+    }
+    object->cell = GRID_NONE;
+}
+
+/**
+ * Adds the object to the grid or moves it
+ * Returns 0 if the object is larger than a cell; it is then left out of the grid
+ */
+uint8_t placeGridObject(uint8_t id, int16_t x, int16_t y, uint8_t width,
+                        uint8_t height)
+{
+    GridObject *object = &gridObjects[id];
+    uint8_t cell = getGridCell(x, y);
+
+    if ((width > GRID_CELL_SIZE) || (height > GRID_CELL_SIZE))
+    {
+        removeGridObject(id);
+        return 0;
+    }
+    if (!gridReady)
+    {
+        clearGrid();
+    }
+    object->x = x;
+    object->y = y;
+    object->width = width;
+    object->height = height;
+    if (object->cell != cell)
+    {
+        if (object->cell != GRID_NONE)
+        {
+            unlinkGridObject(id);
+        }
+        object->cell = cell;
+        object->prev = GRID_NONE;
+        object->next = gridCells[cell];
+        if (object->next != GRID_NONE)
+        {
+            gridObjects[object->next].prev = id;
+        }
+        gridCells[cell] = id;
+    }
+    return 1;
+}
+
+void removeGridObject(uint8_t id)
+{
+    if (gridReady && (gridObjects[id].cell != GRID_NONE))
+    {
+        unlinkGridObject(id);
+    }
+}
+
+/**
+ * Compares the object with every object in the list starting at other
+ * Returns the new number of pairs
+ */
+uint8_t addCandidatePairs(uint8_t id, uint8_t other, CandidatePair pairs[],
+                          uint8_t numOfPairs, uint8_t maxPairs)
+{
+    const GridObject *a = &gridObjects[id], *b;
+    for (; (other != GRID_NONE) && (numOfPairs < maxPairs); other = b->next)
+    {
+        b = &gridObjects[other];
+        if (boxesOverlap(a->x, a->y, a->width, a->height, b->x, b->y,
+                         b->width, b->height))
+        {
+            pairs[numOfPairs].a = (id < other) ? id : other;
+            pairs[numOfPairs].b = (id < other) ? other : id;
+            numOfPairs++;
+        }
+    }
+    return numOfPairs;
+}
+
+/**
+ * Finds each pair of objects whose boxes overlap, once
+ * Returns the number of pairs written, at most maxPairs
+ */
+uint8_t findCandidatePairs(CandidatePair pairs[], uint8_t maxPairs)
+{
+    uint8_t cell, column, row, id, numOfPairs = 0;
+
+    if (!gridReady)
+    {
+        return 0;
+    }
+    for (cell = 0; cell < GRID_ROWS * GRID_COLS; cell++)
+    {
+        column = cell % GRID_COLS;
+        row = cell / GRID_COLS;
+        for (id = gridCells[cell]; id != GRID_NONE; id = gridObjects[id].next)
+        {
+            // Later objects in the same cell, then the right, lower left, lower and lower right cells
+            numOfPairs = addCandidatePairs(id, gridObjects[id].next, pairs,
+                                           numOfPairs, maxPairs);
+            if (column + 1 < GRID_COLS)
+            {
+                numOfPairs = addCandidatePairs(id, gridCells[cell + 1], pairs,
+                                               numOfPairs, maxPairs);
+            }
+            if (row + 1 < GRID_ROWS)
+            {
+                if (column > 0)
+                {
+                    numOfPairs = addCandidatePairs(id, gridCells[cell + GRID_COLS - 1],
+                                                   pairs, numOfPairs, maxPairs);
+                }
+                numOfPairs = addCandidatePairs(id, gridCells[cell + GRID_COLS],
+                                               pairs, numOfPairs, maxPairs);
+                if (column + 1 < GRID_COLS)
+                {
+                    numOfPairs = addCandidatePairs(id, gridCells[cell + GRID_COLS + 1],
+                                                   pairs, numOfPairs, maxPairs);
+                }
+            }
+        }
+    }
+    return numOfPairs;
+}
+
+/**
+ * Entry and exit times along one axis; returns 0 if the boxes never overlap on it
+ */
+uint8_t sweepAxis(Fixed start, Fixed size, Fixed delta, Fixed targetStart,
+                  Fixed targetSize, Fixed *entry, Fixed *exit)
+{
+    if (delta > 0)
+    {
+        *entry = fixedDiv(targetStart - (start + size), delta);
+        *exit = fixedDiv(targetStart + targetSize - start, delta);
+    }
+    else if (delta < 0)
+    {
+        *entry = fixedDiv(targetStart + targetSize - start, delta);
+        *exit = fixedDiv(targetStart - (start + size), delta);
+    }
+    else if ((start < targetStart + targetSize) && (targetStart < start + size))
+    {
+        *entry = FIXED_MIN;
+        *exit = FIXED_MAX;
+    }
+    else
+    {
+        return 0;
+    }
+    return 1;
+}
+
+/**
+ * Updates hit if the box moving by (dx, dy) touches the target earlier
+ * Returns 1 if it did
+ */
+uint8_t sweepBox(const Box *box, Fixed dx, Fixed dy, const Box *target, Hit *hit)
+{
+    Fixed entryX, exitX, entryY, exitY, entry, exit;
+
+    if (!sweepAxis(box->x, box->width, dx, target->x, target->width, &entryX, &exitX)
+            || !sweepAxis(box->y, box->height, dy, target->y, target->height,
+                          &entryY, &exitY))
+    {
+        return 0;
+    }
+    entry = (entryX > entryY) ? entryX : entryY;
+    exit = (exitX < exitY) ? exitX : exitY;
+    if ((entry < 0) || (entry >= exit) || (entry >= hit->time))
+    {
+        return 0;
+    }
+    hit->time = entry;
+    hit->normalX = 0;
+    hit->normalY = 0;
+    if (entryX > entryY)
+    {
+        hit->normalX = (dx > 0) ? -1 : 1;
+    }
+    else
+    {
+        hit->normalY = (dy > 0) ? -1 : 1;
+    }
+    return 1;
+}
+
+/**
+ * Tile covering the pixel, clamped to the grid
+ */
+int16_t getTileIndex(Fixed position, uint8_t tileSize, uint16_t tiles)
+{
+    int32_t tile;
+    if (position < 0)
+    {
+        return -1;
+    }
+    tile = FIXED_TO_INT(position) / tileSize;
+    return (tile < tiles) ? tile : tiles;
+}
+
+/**
+ * Sweeps the box against every solid tile its move passes over
+ */
+void sweepTiles(const Box *box, Fixed dx, Fixed dy, const TileGrid *grid, Hit *hit)
+{
+    Fixed left = box->x + ((dx < 0) ? dx : 0);
+    Fixed right = box->x + box->width + ((dx > 0) ? dx : 0);
+    Fixed top = box->y + ((dy < 0) ? dy : 0);
+    Fixed bottom = box->y + box->height + ((dy > 0) ? dy : 0);
+    int16_t column, row, firstColumn, lastColumn, firstRow, lastRow;
+    Box tile;
+
+    firstColumn = getTileIndex(left, grid->tileSize, grid->columns);
+    lastColumn = getTileIndex(right, grid->tileSize, grid->columns);
+    firstRow = getTileIndex(top, grid->tileSize, grid->rows);
+    lastRow = getTileIndex(bottom, grid->tileSize, grid->rows);
+    tile.width = INT_TO_FIXED(grid->tileSize);
+    tile.height = tile.width;
+
+    for (row = (firstRow < 0) ? 0 : firstRow; (row <= lastRow) && (row < grid->rows); row++)
+    {
+        for (column = (firstColumn < 0) ? 0 : firstColumn;
+                (column <= lastColumn) && (column < grid->columns); column++)
+        {
+            if (grid->tiles[row * grid->columns + column] >= grid->firstSolid)
+            {
+                tile.x = INT_TO_FIXED(column * grid->tileSize);
+                tile.y = INT_TO_FIXED(row * grid->tileSize);
+                sweepBox(box, dx, dy, &tile, hit);
+            }
+        }
+    }
+}
+
+/**
+ * The part of the move made by the given time, rounded towards zero
+ * so the box never ends up inside what it hit
+ */
+Fixed scaleMove(Fixed delta, Fixed time)
+{
+    return (delta < 0) ? -fixedMul(-delta, time) : fixedMul(delta, time);
+}
+
+/**
+ * Moves the box by its velocity for one frame, sliding along tiles and other boxes
+ * Velocity into a surface is removed
+ * Returns the sides of the box that made contact
+ */
+uint8_t moveBox(Box *box, Fixed *vx, Fixed *vy, const TileGrid *grid,
+                const Box others[], uint8_t numOfOthers)
+{
+    Fixed dx = *vx, dy = *vy;
+    uint8_t step, i, sides = 0;
+    Hit hit;
+
+    for (step = 0; (step < MAX_RESOLVE_STEPS) && (dx || dy); step++)
+    {
+        hit.time = FIXED_ONE;
+        if (grid)
+        {
+            sweepTiles(box, dx, dy, grid, &hit);
+        }
+        for (i = 0; i < numOfOthers; i++)
+        {
+            sweepBox(box, dx, dy, &others[i], &hit);
+        }
+        box->x += scaleMove(dx, hit.time);
+        box->y += scaleMove(dy, hit.time);
+        if (hit.time == FIXED_ONE)
+        {
+            return sides;
+        }
+        dx -= scaleMove(dx, hit.time);
+        dy -= scaleMove(dy, hit.time);
+        if (hit.normalX)
+        {
+            sides |= (hit.normalX < 0) ? CONTACT_RIGHT : CONTACT_LEFT;
+            dx = 0;
+            *vx = 0;
+        }
+        else
+        {
+            sides |= (hit.normalY < 0) ? CONTACT_BOTTOM : CONTACT_TOP;
+            dy = 0;
+            *vy = 0;
+        }
+    }
+    return sides;
+}
@@ -0,0 +1,87 @@
+#ifndef COLLISION_H
+#define COLLISION_H
+
+#include <stdint.h>
+#include "sprite.h"
+#include "fixed.h"
+
+/**
+ * ==================================================================
+ * Collision
+ * ==================================================================
+ */
+
+enum
+{
+    GRID_CELL_SIZE = 16, // Largest box the grid can hold, in pixels
+    GRID_COLS = (COLS + GRID_CELL_SIZE - 1) / GRID_CELL_SIZE,
+    GRID_ROWS = (ROWS + GRID_CELL_SIZE - 1) / GRID_CELL_SIZE,
+    MAX_GRID_OBJECTS = 32,
+    GRID_NONE = 0xFF,
+    MAX_RESOLVE_STEPS = 3 // Slides along at most this many surfaces a frame
+};
+
+typedef enum
+{
+    CONTACT_LEFT = (1 << 0),
+    CONTACT_RIGHT = (1 << 1),
+    CONTACT_TOP = (1 << 2),
+    CONTACT_BOTTOM = (1 << 3)
+} ContactSide;
+
+typedef struct Contacts {
+    int16_t x, y; // First overlapping pixel: leftmost column, then topmost row
+} Contact;
+
+/**
+ * Each object is linked into the list of the cell holding its top left corner
+ */
+typedef struct GridObjects {
+    int16_t x, y;
+    uint8_t width, height;
+    uint8_t cell; // GRID_NONE: not in the grid
+    uint8_t next, prev;
+} GridObject;
+
+typedef struct CandidatePairs {
+    uint8_t a, b; // Object ids, a < b
+} CandidatePair;
+
+extern GridObject gridObjects[MAX_GRID_OBJECTS];
+
+typedef struct Boxes {
+    Fixed x, y, width, height; // Pixels
+} Box;
+
+/**
+ * Row major tile indices; tiles from firstSolid up are solid
+ */
+typedef struct TileGrids {
+    const uint8_t *tiles;
+    uint16_t columns, rows;
+    uint8_t tileSize; // Pixels
+    uint8_t firstSolid;
+} TileGrid;
+
+typedef struct Hits {
+    Fixed time; // Fraction of the move before contact; FIXED_ONE: no contact
+    int8_t normalX, normalY; // Points away from the surface hit
+} Hit;
+
+/* ================================================================== */
+
+uint8_t boxesOverlap(int16_t ax, int16_t ay, uint8_t aWidth, uint8_t aHeight,
+                     int16_t bx, int16_t by, uint8_t bWidth, uint8_t bHeight);
+uint8_t spritesCollide(const Sprite *a, const Sprite *b, Contact *contact);
+
+void clearGrid();
+uint8_t placeGridObject(uint8_t id, int16_t x, int16_t y, uint8_t width, uint8_t height);
+void removeGridObject(uint8_t id);
+uint8_t findCandidatePairs(CandidatePair pairs[], uint8_t maxPairs);
+
+uint8_t sweepBox(const Box *box, Fixed dx, Fixed dy, const Box *target, Hit *hit);
+void sweepTiles(const Box *box, Fixed dx, Fixed dy, const TileGrid *grid, Hit *hit);
+uint8_t moveBox(Box *box, Fixed *vx, Fixed *vy, const TileGrid *grid,
+                const Box others[], uint8_t numOfOthers);
+
+#endif // COLLISION_H
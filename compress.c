@@ -0,0 +1,192 @@
+/**
+ * ==================================================================
+ * Compressed Assets
+ * ==================================================================
+ *
+ * Tokens are either literal bytes, a run of one byte (common in bank
+ * data, where blank columns are 0x00 and solid ones 0xFF) or a copy of
+ * bytes already written (the same column in the bank above, or a
+ * repeated glyph or tile).
+ *
+ * The decoder reads the asset once, in order, and writes straight into
+ * its destination. Copies read back from the destination itself, so no
+ * window or other buffer is needed.
+ *
+ * An image stored a bank at a time can also be decoded into a rectangle
+ * of a wider buffer, such as a sprite sheet or the frame buffer: each bank
+ * of the image goes to the next bank of the destination, stride bytes on.
+ * Copies are followed through the same mapping.
+ *
+ * ==================================================================
+ * ==================================================================
+ */
+
+#include "compress.h"
+#include "lcd.h"
+
+enum
+{
+    MIN_RUN = 3,
+    RUN_TOKEN = 0x80,
+    COPY_TOKEN = 0xC0
+};
+
+uint16_t getDecompressedSize(const uint8_t packed[])
+{
+    return packed[0] | (packed[1] << 8);
+}
+
+/**
+ * Decodes the asset into dest, stopping early if it would not fit
+ * or at a copy from before the start of dest (a corrupt asset)
+ * Returns the number of bytes written
+ */
+uint16_t decompress(const uint8_t packed[], uint8_t dest[], uint16_t capacity)
+{
+    uint16_t size = getDecompressedSize(packed), written = 0, length, count;
+    const uint8_t *src = packed + 2, *from;
+    uint8_t token, value;
+    uint8_t *to;
+
+    if (size > capacity)
+    {
+        size = capacity;
+    }
+    while (written < size)
+    {
+        token = *src++;
+        length = (token < RUN_TOKEN) ? token + 1 : (token & 0x3F) + MIN_RUN;
+        count = (length < size - written) ? length : size - written;
+        to = dest + written;
+        written += count;
+
+        if (token < RUN_TOKEN)
+        {
+            for (from = src; count > 0; count--)
+            {
+                *to++ = *from++;
+            }
+            src += length;
+        }
+        else if (token < COPY_TOKEN)
+        {
+            for (value = *src++; count > 0; count--)
+            {
+                *to++ = value;
+            }
+        }
+        else
+        {
+            from = to - *src++ - 1;
+            if (from < dest)
+            {
+                return written - count;
+            }
+            for (; count > 0; count--)
+            {
+                *to++ = *from++;
+            }
+        }
+    }
+    return written;
+}
+
+/**
+ * Decodes an image stored a bank at a time into any buffer with the display's bank layout
+ * The image is width columns wide; its top left byte goes to column x of bank y
+ * stride: columns in each bank of dest
+ * Stops early at the last bank of dest, or at a copy from before the start of the image
+ * Returns the number of bytes written; 0 if the image does not fit across dest
+ */
+uint16_t decompressImage(const uint8_t packed[], uint8_t dest[], uint8_t stride,
+                         uint8_t destBanks, uint8_t x, uint8_t y, uint8_t width)
+{
+    uint16_t size = getDecompressedSize(packed), written = 0, length, count, back;
+    const uint8_t *src = packed + 2;
+    uint8_t token, value = 0, column = 0, fromColumn = 0;
+    uint8_t *row, *fromRow = 0;
+
+    if ((width == 0) || (x + width > stride) || (y >= destBanks))
+    {
+        return 0;
+    }
+    if (size > (destBanks - y) * width)
+    {
+        size = (destBanks - y) * width;
+    }
+    row = dest + y * stride + x;
+
+    while (written < size)
+    {
+        token = *src++;
+        length = (token < RUN_TOKEN) ? token + 1 : (token & 0x3F) + MIN_RUN;
+        count = (length < size - written) ? length : size - written;
+
+        if (token < RUN_TOKEN)
+        {
+            length -= count; // Literals left over past the end
+        }
+        else if (token < COPY_TOKEN)
+        {
+            value = *src++;
+        }
+        else
+        {
+            back = *src++ + 1;
+            if (back > written)
+            {
+                return written;
+            }
+            fromRow = dest + (y + (written - back) / width) * stride + x;
+            fromColumn = (written - back) % width;
+        }
+
+        for (written += count; count > 0; count--)
+        {
+            if (token < RUN_TOKEN)
+            {
+                value = *src++;
+            }
+            else if (token >= COPY_TOKEN)
+            {
+                value = fromRow[fromColumn];
+                if (++fromColumn == width)
+                {
+                    fromColumn = 0;
+                    fromRow += stride;
+                }
+            }
+            row[column] = value;
+            if (++column == width)
+            {
+                column = 0;
+                row += stride;
+            }
+        }
+        if (token < RUN_TOKEN)
+        {
+            src += length;
+        }
+    }
+    return written;
+}
+
+/**
+ * Decodes an image stored a bank at a time straight into the frame buffer
+ * and marks the columns it covers dirty
+ * Returns the number of bytes written
+ */
+uint16_t drawCompressedShape(uint8_t x, uint8_t y, const uint8_t packed[], uint8_t width)
+{
+    uint16_t written = decompressImage(packed, &frameBuffer[0][0], COLS, BANKS, x, y,
+                                       width);
+    uint16_t left;
+    uint8_t bank;
+
+    for (bank = 0; bank * width < written; bank++)
+    {
+        left = written - bank * width;
+        markDirty(x, y + bank, (left < width) ? left : width);
+    }
+    return written;
+}
@@ -0,0 +1,23 @@
+#ifndef COMPRESS_H
+#define COMPRESS_H
+
+#include <stdint.h>
+
+/**
+ * ==================================================================
+ * Compressed Assets
+ * ==================================================================
+ *
+ * Assets are compressed on the host by Tools/compress.py, which also
+ * describes the format.
+ */
+
+/* ================================================================== */
+
+uint16_t getDecompressedSize(const uint8_t packed[]);
+uint16_t decompress(const uint8_t packed[], uint8_t dest[], uint16_t capacity);
+uint16_t decompressImage(const uint8_t packed[], uint8_t dest[], uint8_t stride,
+                         uint8_t destBanks, uint8_t x, uint8_t y, uint8_t width);
+uint16_t drawCompressedShape(uint8_t x, uint8_t y, const uint8_t packed[], uint8_t width);
+
+#endif // COMPRESS_H
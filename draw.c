@@ -0,0 +1,253 @@
+/**
+ * ==================================================================
+ * Lines, Rectangles and Circles
+ * ==================================================================
+ *
+ * Pixels are set straight in frameBuffer, and the box a shape covers is
+ * marked dirty once when it is done rather than pixel by pixel.
+ *
+ * Horizontal lines OR one bit mask along a bank. Vertical lines and
+ * filled rectangles set a whole byte in each bank they cross and a
+ * partial mask at either end. Other lines use Bresenham's algorithm and
+ * circles the midpoint algorithm, so neither needs a multiply or divide
+ * per pixel.
+ *
+ * Single Pixels:
+ * On the TM4C123, every bit of SRAM has its own word in the bit-band
+ * alias region (see 2.4.5 Bit-Banding in the data sheet). Writing 1 or 0
+ * to the word sets or clears just that bit, so a pixel is set or cleared
+ * with one store instead of a load, mask and store, and an interrupt
+ * cannot slip in between. Toggling still reads the word and writes it
+ * back, so it is not atomic: an interrupt that changes the same pixel in
+ * between is lost. Other targets fall back to masking the byte.
+ *
+ * ==================================================================
+ * ==================================================================
+ */
+
+#include "draw.h"
+
+void setPixel(int16_t x, int16_t y)
+{
+    if (ON_DISPLAY(x, y))
+    {
+        SET_PIXEL(x, y);
+        markDirty(x, y >> 3, 1);
+    }
+}
+
+void clearPixel(int16_t x, int16_t y)
+{
+    if (ON_DISPLAY(x, y))
+    {
+        CLEAR_PIXEL(x, y);
+        markDirty(x, y >> 3, 1);
+    }
+}
+
+void togglePixel(int16_t x, int16_t y)
+{
+    if (ON_DISPLAY(x, y))
+    {
+        TOGGLE_PIXEL(x, y);
+        markDirty(x, y >> 3, 1);
+    }
+}
+
+/**
+ * Returns 1 if the pixel is set; pixels off the display are clear
+ */
+uint8_t getPixel(int16_t x, int16_t y)
+{
+    return ON_DISPLAY(x, y) ? TEST_PIXEL(x, y) : 0;
+}
+
+/**
+ * Marks the part of the box [left, right] x [top, bottom] on the display dirty
+ */
+void markDirtyBox(int16_t left, int16_t top, int16_t right, int16_t bottom)
+{
+    uint8_t bank;
+
+    left = (left < 0) ? 0 : left;
+    top = (top < 0) ? 0 : top;
+    right = (right >= COLS) ? COLS - 1 : right;
+    bottom = (bottom >= ROWS) ? ROWS - 1 : bottom;
+    if ((left > right) || (top > bottom))
+    {
+        return;
+    }
+    for (bank = top >> 3; bank <= (bottom >> 3); bank++)
+    {
+        markDirty(left, bank, right - left + 1);
+    }
+}
+
+/**
+ * Sets rows [top, bottom] of columns [left, right]; the box must be on the display
+ */
+void fillBox(int16_t left, int16_t top, int16_t right, int16_t bottom)
+{
+    uint8_t bank, mask, x;
+
+    for (bank = top >> 3; bank <= (bottom >> 3); bank++)
+    {
+        mask = 0xFF;
+        if (bank == (top >> 3))
+        {
+            mask &= (uint8_t) (0xFF << (top & 7));
+        }
+        if (bank == (bottom >> 3))
+        {
+            mask &= (uint8_t) (0xFF >> (7 - (bottom & 7)));
+        }
+        for (x = left; x <= right; x++)
+        {
+            frameBuffer[bank][x] |= mask;
+        }
+    }
+}
+
+/**
+ * Clips the box to the display, fills it and marks it dirty
+ */
+void fillClippedBox(int16_t left, int16_t top, int16_t right, int16_t bottom)
+{
+    left = (left < 0) ? 0 : left;
+    top = (top < 0) ? 0 : top;
+    right = (right >= COLS) ? COLS - 1 : right;
+    bottom = (bottom >= ROWS) ? ROWS - 1 : bottom;
+    if ((left <= right) && (top <= bottom))
+    {
+        fillBox(left, top, right, bottom);
+        markDirtyBox(left, top, right, bottom);
+    }
+}
+
+void drawHorizontalLine(int16_t x0, int16_t x1, int16_t y)
+{
+    if (x0 > x1)
+    {
+        int16_t x = x0;
+        x0 = x1;
+        x1 = x;
+    }
+    fillClippedBox(x0, y, x1, y);
+}
+
+void drawVerticalLine(int16_t x, int16_t y0, int16_t y1)
+{
+    if (y0 > y1)
+    {
+        int16_t y = y0;
+        y0 = y1;
+        y1 = y;
+    }
+    fillClippedBox(x, y0, x, y1);
+}
+
+void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+    int16_t dx = (x1 > x0) ? x1 - x0 : x0 - x1;
+    int16_t dy = (y1 > y0) ? y0 - y1 : y1 - y0; // Negative
+    int8_t stepX = (x0 < x1) ? 1 : -1, stepY = (y0 < y1) ? 1 : -1;
+    int16_t error = dx + dy, x = x0, y = y0, twice;
+
+    if (y0 == y1)
+    {
+        drawHorizontalLine(x0, x1, y0);
+        return;
+    }
+    if (x0 == x1)
+    {
+        drawVerticalLine(x0, y0, y1);
+        return;
+    }
+    for (;;)
+    {
+        if (ON_DISPLAY(x, y))
+        {
+            SET_PIXEL(x, y);
+        }
+        if ((x == x1) && (y == y1))
+        {
+            break;
+        }
+        twice = error * 2;
+        if (twice >= dy)
+        {
+            error += dy;
+            x += stepX;
+        }
+        if (twice <= dx)
+        {
+            error += dx;
+            y += stepY;
+        }
+    }
+    markDirtyBox((x0 < x1) ? x0 : x1, (y0 < y1) ? y0 : y1,
+                 (x0 < x1) ? x1 : x0, (y0 < y1) ? y1 : y0);
+}
+
+void drawRect(int16_t x, int16_t y, int16_t width, int16_t height)
+{
+    if ((width <= 0) || (height <= 0))
+    {
+        return;
+    }
+    drawHorizontalLine(x, x + width - 1, y);
+    drawHorizontalLine(x, x + width - 1, y + height - 1);
+    drawVerticalLine(x, y, y + height - 1);
+    drawVerticalLine(x + width - 1, y, y + height - 1);
+}
+
+void fillRect(int16_t x, int16_t y, int16_t width, int16_t height)
+{
+    if ((width > 0) && (height > 0))
+    {
+        fillClippedBox(x, y, x + width - 1, y + height - 1);
+    }
+}
+
+/**
+ * Sets the pixel if it is on the display
+ */
+void plotPixel(int16_t x, int16_t y)
+{
+    if (ON_DISPLAY(x, y))
+    {
+        SET_PIXEL(x, y);
+    }
+}
+
+void drawCircle(int16_t cx, int16_t cy, int16_t radius)
+{
+    int16_t x = radius, y = 0, error = 1 - radius;
+
+    if (radius < 0)
+    {
+        return;
+    }
+    while (x >= y)
+    {
+        plotPixel(cx + x, cy + y);
+        plotPixel(cx - x, cy + y);
+        plotPixel(cx + x, cy - y);
+        plotPixel(cx - x, cy - y);
+        plotPixel(cx + y, cy + x);
+        plotPixel(cx - y, cy + x);
+        plotPixel(cx + y, cy - x);
+        plotPixel(cx - y, cy - x);
+        y++;
+        if (error < 0)
+        {
+            error += 2 * y + 1;
+        }
+        else
+        {
+            x--;
+            error += 2 * (y - x) + 1;
+        }
+    }
+    markDirtyBox(cx - radius, cy - radius, cx + radius, cy + radius);
+}
@@ -0,0 +1,51 @@
+#ifndef DRAW_H
+#define DRAW_H
+
+#include <stdint.h>
+#include "lcd.h"
+
+/**
+ * ==================================================================
+ * Lines, Rectangles and Circles
+ * ==================================================================
+ *
+ * Coordinates are pixels and may be off the display; shapes are clipped.
+ */
+
+/**
+ * Single pixels of frameBuffer, through the bit-band alias on the TM4C123
+ * These do not clip or mark dirty: check ON_DISPLAY first
+ */
+#define ON_DISPLAY(x, y) (((uint16_t) (x) < COLS) && ((uint16_t) (y) < ROWS))
+
+#ifdef PART_TM4C123GH6PM
+#define SRAM_BASE (0x20000000)
+#define SRAM_BIT_BAND_BASE (0x22000000)
+#define PIXEL_WORD(x, y) (*(volatile uint32_t *) (SRAM_BIT_BAND_BASE \
+        + (((uint32_t) &frameBuffer[(y) >> 3][x] - SRAM_BASE) << 5) + (((y) & 7) << 2)))
+#define SET_PIXEL(x, y) (PIXEL_WORD(x, y) = 1)
+#define CLEAR_PIXEL(x, y) (PIXEL_WORD(x, y) = 0)
+#define TOGGLE_PIXEL(x, y) (PIXEL_WORD(x, y) ^= 1) // Read, then write: not atomic
+#define TEST_PIXEL(x, y) ((uint8_t) PIXEL_WORD(x, y))
+#else
+#define SET_PIXEL(x, y) (frameBuffer[(y) >> 3][x] |= (uint8_t) (1 << ((y) & 7)))
+#define CLEAR_PIXEL(x, y) (frameBuffer[(y) >> 3][x] &= (uint8_t) ~(1 << ((y) & 7)))
+#define TOGGLE_PIXEL(x, y) (frameBuffer[(y) >> 3][x] ^= (uint8_t) (1 << ((y) & 7)))
+#define TEST_PIXEL(x, y) ((frameBuffer[(y) >> 3][x] >> ((y) & 7)) & 1)
+#endif
+
+/* ================================================================== */
+
+void setPixel(int16_t x, int16_t y);
+void clearPixel(int16_t x, int16_t y);
+void togglePixel(int16_t x, int16_t y);
+uint8_t getPixel(int16_t x, int16_t y);
+
+void drawHorizontalLine(int16_t x0, int16_t x1, int16_t y);
+void drawVerticalLine(int16_t x, int16_t y0, int16_t y1);
+void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+void drawRect(int16_t x, int16_t y, int16_t width, int16_t height);
+void fillRect(int16_t x, int16_t y, int16_t width, int16_t height);
+void drawCircle(int16_t cx, int16_t cy, int16_t radius);
+
+#endif // DRAW_H
@@ -0,0 +1,155 @@
+/**
+ * ==================================================================
+ * Entities
+ * ==================================================================
+ *
+ * Entities are stored as one array per component rather than an array of
+ * structures, so a pass over one component (moving every entity, say) only
+ * reads the arrays it needs. Slots come from a fixed pool: free slots are
+ * chained through entityNextFree, so creating and destroying an entity
+ * never searches the pool.
+ *
+ * ==================================================================
+ * ==================================================================
+ */
+
+#include "entity.h"
+#include "camera.h"
+
+int16_t entityX[MAX_ENTITIES], entityY[MAX_ENTITIES];
+int8_t entityDX[MAX_ENTITIES], entityDY[MAX_ENTITIES];
+uint8_t entityType[MAX_ENTITIES];
+Sprite *entitySprite[MAX_ENTITIES];
+
+uint16_t entityGeneration[MAX_ENTITIES]; // Even: free, odd: in use
+uint8_t entityNextFree[MAX_ENTITIES];
+uint8_t firstFreeEntity = NO_INDEX;
+uint8_t numOfEntities;
+uint8_t entitiesReady;
+
+void clearEntities()
+{
+    uint8_t i = MAX_ENTITIES;
+    firstFreeEntity = NO_INDEX;
+    while (i-- > 0)
+    {
+        entityGeneration[i] += entityGeneration[i] & 1; // Invalidates live handles
+        if (entityGeneration[i] != RETIRED_GENERATION)
+        {
+            entityNextFree[i] = firstFreeEntity;
+            firstFreeEntity = i;
+        }
+    }
+    numOfEntities = 0;
+    entitiesReady = 1;
+}
+
+/**
+ * Returns NO_ENTITY if every slot is in use or retired
+ */
+Entity createEntity(uint8_t type, int16_t x, int16_t y)
+{
+    uint8_t i;
+
+    if (!entitiesReady)
+    {
+        clearEntities();
+    }
+    i = firstFreeEntity;
+    if (i == NO_INDEX)
+    {
+        return NO_ENTITY;
+    }
+    firstFreeEntity = entityNextFree[i];
+    entityGeneration[i]++;
+    entityX[i] = x;
+    entityY[i] = y;
+    entityDX[i] = 0;
+    entityDY[i] = 0;
+    entityType[i] = type;
+    entitySprite[i] = 0;
+    numOfEntities++;
+    return getEntityHandle(i);
+}
+
+void destroyEntity(Entity entity)
+{
+    uint8_t i = getEntityIndex(entity);
+    if (i != NO_INDEX)
+    {
+        entityGeneration[i]++;
+        if (entityGeneration[i] != RETIRED_GENERATION)
+        {
+            entityNextFree[i] = firstFreeEntity;
+            firstFreeEntity = i;
+        }
+        numOfEntities--;
+    }
+}
+
+/**
+ * Returns the slot of a live entity, or NO_INDEX for a stale handle
+ */
+uint8_t getEntityIndex(Entity entity)
+{
+    uint8_t i = entity & 0xFF;
+    if ((i < MAX_ENTITIES) && (entityGeneration[i] & 1)
+            && (entityGeneration[i] == (entity >> 8)))
+    {
+        return i;
+    }
+    return NO_INDEX;
+}
+
+uint8_t isEntityAlive(Entity entity)
+{
+    return getEntityIndex(entity) != NO_INDEX;
+}
+
+/**
+ * Returns the handle of the entity in the slot, or NO_ENTITY for a free slot
+ */
+Entity getEntityHandle(uint8_t index)
+{
+    if (entityGeneration[index] & 1)
+    {
+        return ((Entity) entityGeneration[index] << 8) | index;
+    }
+    return NO_ENTITY;
+}
+
+/**
+ * Moves every live entity by its velocity and takes its sprite along
+ * Sprites of entities off the display are culled
+ */
+void updateEntities()
+{
+    uint8_t i;
+    Sprite *sprite;
+
+    for (i = 0; i < MAX_ENTITIES; i++)
+    {
+        if (entityGeneration[i] & 1)
+        {
+            entityX[i] += entityDX[i];
+            entityY[i] += entityDY[i];
+        }
+    }
+    for (i = 0; i < MAX_ENTITIES; i++)
+    {
+        sprite = entitySprite[i];
+        if (sprite && (entityGeneration[i] & 1))
+        {
+            moveSprite(sprite, entityX[i] - camera.x, entityY[i] - camera.y);
+            if (isBoxVisible(entityX[i], entityY[i], sprite->image->width,
+                             sprite->image->height))
+            {
+                setSpriteFlags(sprite, sprite->flags & ~SPRITE_CULLED);
+            }
+            else
+            {
+                setSpriteFlags(sprite, sprite->flags | SPRITE_CULLED);
+            }
+        }
+    }
+}
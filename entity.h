@@ -0,0 +1,48 @@
+#ifndef ENTITY_H
+#define ENTITY_H
+
+#include <stdint.h>
+#include "sprite.h"
+
+/**
+ * ==================================================================
+ * Entities
+ * ==================================================================
+ *
+ * A handle is the entity's slot in the low byte and the slot's 16-bit
+ * generation above it. Destroying an entity moves its slot to the next
+ * generation, so old handles to it stop resolving. A slot whose generation
+ * would wrap is retired instead of reused.
+ */
+
+enum
+{
+    MAX_ENTITIES = 32,
+    NO_ENTITY = 0, // Never a valid handle: generations start at 1
+    NO_INDEX = 0xFF,
+    RETIRED_GENERATION = 0xFFFE // Free slots reaching it are never reused
+};
+
+typedef uint32_t Entity;
+
+/**
+ * Components, one array each, indexed by slot
+ */
+extern int16_t entityX[MAX_ENTITIES], entityY[MAX_ENTITIES]; // World pixels
+extern int8_t entityDX[MAX_ENTITIES], entityDY[MAX_ENTITIES]; // Pixels per frame
+extern uint8_t entityType[MAX_ENTITIES];
+extern Sprite *entitySprite[MAX_ENTITIES];
+
+extern uint8_t numOfEntities;
+
+/* ================================================================== */
+
+void clearEntities();
+Entity createEntity(uint8_t type, int16_t x, int16_t y);
+void destroyEntity(Entity entity);
+uint8_t getEntityIndex(Entity entity);
+uint8_t isEntityAlive(Entity entity);
+Entity getEntityHandle(uint8_t index);
+void updateEntities();
+
+#endif // ENTITY_H
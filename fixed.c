@@ -0,0 +1,245 @@
+/**
+ * ==================================================================
+ * Fixed Point
+ * ==================================================================
+ *
+ * Arithmetic saturates at the largest and smallest value of the type
+ * rather than wrapping, so an overflow shows up as a value stuck at
+ * its limit instead of an object jumping across the display. Division
+ * by zero gives the limit with the sign of the dividend.
+ *
+ * The sine table holds a quarter turn and the arctangent table one
+ * octant; both are const so they stay in flash.
+ *
+ * ==================================================================
+ * ==================================================================
+ */
+
+#include "fixed.h"
+
+/**
+ * sin(i / 256 turns) in Q16.16, i = 0..64
+ */
+const int32_t sineTable[ANGLE_QUARTER + 1] =
+{
+    0, 1608, 3216, 4821, 6424, 8022, 9616, 11204, 12785, 14359, 15924,
+    17479, 19024, 20557, 22078, 23586, 25080, 26558, 28020, 29466, 30893,
+    32303, 33692, 35062, 36410, 37736, 39040, 40320, 41576, 42806, 44011,
+    45190, 46341, 47464, 48559, 49624, 50660, 51665, 52639, 53581, 54491,
+    55368, 56212, 57022, 57798, 58538, 59244, 59914, 60547, 61145, 61705,
+    62228, 62714, 63162, 63572, 63944, 64277, 64571, 64827, 65043, 65220,
+    65358, 65457, 65516, 65536
+};
+
+/**
+ * atan(i / 32) in 1/256 steps of Angle, i = 0..32
+ */
+const uint16_t arctanTable[33] =
+{
+    0, 326, 651, 975, 1297, 1617, 1933, 2246, 2555, 2860, 3159, 3453, 3742,
+    4025, 4302, 4572, 4836, 5094, 5344, 5589, 5826, 6058, 6282, 6500, 6712,
+    6917, 7117, 7310, 7498, 7679, 7856, 8026, 8192
+};
+
+/**
+ * sin in Q16.16 from the quarter wave table
+ */
+int32_t lookUpSine(Angle angle)
+{
+    uint8_t step = angle & (ANGLE_QUARTER - 1);
+    int32_t value;
+
+    if (angle & ANGLE_QUARTER)
+    {
+        step = ANGLE_QUARTER - step;
+    }
+    value = sineTable[step];
+    return (angle & ANGLE_HALF) ? -value : value;
+}
+
+/**
+ * Angle from the ratio of the smaller to the larger component
+ */
+Angle lookUpArctan(uint32_t y, uint32_t x)
+{
+    uint32_t ratio, step, angle;
+    uint8_t swapped = y > x;
+
+    if (swapped)
+    {
+        ratio = y;
+        y = x;
+        x = ratio;
+    }
+    ratio = (uint32_t) (((uint64_t) y << 13) / x); // 0..8192: table step in the top bits
+    step = ratio >> 8;
+    angle = arctanTable[step];
+    if (step < 32)
+    {
+        angle += ((arctanTable[step + 1] - arctanTable[step]) * (ratio & 0xFF)) >> 8;
+    }
+    if (swapped)
+    {
+        angle = ANGLE_QUARTER * 256 - angle;
+    }
+    return (Angle) ((angle + 128) >> 8);
+}
+
+#ifdef FIXED_FLOAT
+
+Fixed fixedAdd(Fixed a, Fixed b)
+{
+    return a + b;
+}
+
+Fixed fixedSub(Fixed a, Fixed b)
+{
+    return a - b;
+}
+
+Fixed fixedMul(Fixed a, Fixed b)
+{
+    return a * b;
+}
+
+Fixed fixedDiv(Fixed a, Fixed b)
+{
+    if (b == 0)
+    {
+        return (a < 0) ? FIXED_MIN : FIXED_MAX;
+    }
+    return a / b;
+}
+
+Fixed fixedSin(Angle angle)
+{
+    return lookUpSine(angle) * (1.0f / 65536);
+}
+
+/**
+ * Components are scaled to keep the ratio's precision
+ */
+Angle fixedAtan2(Fixed y, Fixed x)
+{
+    Fixed ax = (x < 0) ? -x : x, ay = (y < 0) ? -y : y;
+    Fixed larger = (ax > ay) ? ax : ay;
+    Angle angle;
+
+    if (larger == 0)
+    {
+        return 0;
+    }
+    angle = lookUpArctan((uint32_t) (ay / larger * 65536.0f),
+                         (uint32_t) (ax / larger * 65536.0f));
+    if (x < 0)
+    {
+        angle = ANGLE_HALF - angle;
+    }
+    return (y < 0) ? (Angle) -angle : angle;
+}
+
+#else
+
+Fixed saturate(int64_t value)
+{
+    if (value > FIXED_MAX)
+    {
+        return FIXED_MAX;
+    }
+    if (value < FIXED_MIN)
+    {
+        return FIXED_MIN;
+    }
+    return (Fixed) value;
+}
+
+Fixed fixedAdd(Fixed a, Fixed b)
+{
+    return saturate((int64_t) a + b);
+}
+
+Fixed fixedSub(Fixed a, Fixed b)
+{
+    return saturate((int64_t) a - b);
+}
+
+Fixed fixedMul(Fixed a, Fixed b)
+{
+    return saturate(((int64_t) a * b) >> 16);
+}
+
+Fixed fixedDiv(Fixed a, Fixed b)
+{
+    if (b == 0)
+    {
+        return (a < 0) ? FIXED_MIN : FIXED_MAX;
+    }
+    return saturate(((int64_t) a * FIXED_ONE) / b);
+}
+
+Fixed fixedSin(Angle angle)
+{
+    return lookUpSine(angle);
+}
+
+Angle fixedAtan2(Fixed y, Fixed x)
+{
+    uint32_t ax = (x < 0) ? 0u - (uint32_t) x : (uint32_t) x;
+    uint32_t ay = (y < 0) ? 0u - (uint32_t) y : (uint32_t) y;
+    Angle angle;
+
+    if ((ax | ay) == 0)
+    {
+        return 0;
+    }
+    angle = lookUpArctan(ay, ax);
+    if (x < 0)
+    {
+        angle = ANGLE_HALF - angle;
+    }
+    return (y < 0) ? (Angle) -angle : angle;
+}
+
+#endif // FIXED_FLOAT
+
+Fixed fixedCos(Angle angle)
+{
+    return fixedSin(angle + ANGLE_QUARTER);
+}
+
+Fixed8 saturate8(int32_t value)
+{
+    if (value > FIXED8_MAX)
+    {
+        return FIXED8_MAX;
+    }
+    if (value < FIXED8_MIN)
+    {
+        return FIXED8_MIN;
+    }
+    return (Fixed8) value;
+}
+
+Fixed8 fixed8Add(Fixed8 a, Fixed8 b)
+{
+    return saturate8((int32_t) a + b);
+}
+
+Fixed8 fixed8Sub(Fixed8 a, Fixed8 b)
+{
+    return saturate8((int32_t) a - b);
+}
+
+Fixed8 fixed8Mul(Fixed8 a, Fixed8 b)
+{
+    return saturate8(((int32_t) a * b) >> 8);
+}
+
+Fixed8 fixed8Div(Fixed8 a, Fixed8 b)
+{
+    if (b == 0)
+    {
+        return (a < 0) ? FIXED8_MIN : FIXED8_MAX;
+    }
+    return saturate8(((int32_t) a * FIXED8_ONE) / b);
+}
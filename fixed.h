@@ -0,0 +1,81 @@
+#ifndef FIXED_H
+#define FIXED_H
+
+#include <stdint.h>
+
+/**
+ * ==================================================================
+ * Fixed Point
+ * ==================================================================
+ *
+ * Fixed: Q16.16, for positions and velocities
+ * Fixed8: Q8.8, for values that have to be small (particles, tables)
+ * Angle: 256 steps per turn
+ *
+ * Build with FIXED_FLOAT defined to make Fixed a float, to compare the
+ * game's behaviour or speed against the fixed point version. Fixed8 stays
+ * fixed point either way.
+ *
+ * FIXED() and FIXED8() turn float constants into fixed point at compile
+ * time, so no float code is generated for them.
+ */
+
+typedef int16_t Fixed8;
+typedef uint8_t Angle;
+
+#define FIXED8_ONE (1 << 8)
+#define FIXED8_MAX ((Fixed8) 0x7FFF)
+#define FIXED8_MIN ((Fixed8) -0x8000)
+#define FIXED8(f) ((Fixed8) ((f) * 256.0 + (((f) >= 0) ? 0.5 : -0.5)))
+#define INT_TO_FIXED8(i) ((Fixed8) ((i) * FIXED8_ONE))
+#define FIXED8_TO_INT(f) ((f) >> 8)
+
+enum
+{
+    ANGLE_QUARTER = 64, ANGLE_HALF = 128
+};
+
+#ifdef FIXED_FLOAT
+
+#include <math.h>
+
+typedef float Fixed;
+
+#define FIXED_ONE (1.0f)
+#define FIXED_MAX (3.4e38f)
+#define FIXED_MIN (-3.4e38f)
+#define FIXED(f) ((Fixed) (f))
+#define INT_TO_FIXED(i) ((Fixed) (i))
+#define FIXED_TO_INT(f) ((int32_t) floorf(f)) // Rounds down like >> 16
+#define FIXED_TO_FIXED8(f) ((Fixed8) ((f) * 256.0f))
+
+#else
+
+typedef int32_t Fixed;
+
+#define FIXED_ONE (1L << 16)
+#define FIXED_MAX ((Fixed) 0x7FFFFFFF)
+#define FIXED_MIN ((Fixed) -0x7FFFFFFF - 1)
+#define FIXED(f) ((Fixed) ((f) * 65536.0 + (((f) >= 0) ? 0.5 : -0.5)))
+#define INT_TO_FIXED(i) ((Fixed) ((i) * FIXED_ONE))
+#define FIXED_TO_INT(f) ((int32_t) ((f) >> 16))
+#define FIXED_TO_FIXED8(f) ((Fixed8) ((f) >> 8))
+
+#endif // FIXED_FLOAT
+
+/* ================================================================== */
+
+Fixed fixedAdd(Fixed a, Fixed b);
+Fixed fixedSub(Fixed a, Fixed b);
+Fixed fixedMul(Fixed a, Fixed b);
+Fixed fixedDiv(Fixed a, Fixed b);
+Fixed fixedSin(Angle angle);
+Fixed fixedCos(Angle angle);
+Angle fixedAtan2(Fixed y, Fixed x);
+
+Fixed8 fixed8Add(Fixed8 a, Fixed8 b);
+Fixed8 fixed8Sub(Fixed8 a, Fixed8 b);
+Fixed8 fixed8Mul(Fixed8 a, Fixed8 b);
+Fixed8 fixed8Div(Fixed8 a, Fixed8 b);
+
+#endif // FIXED_H
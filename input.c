@@ -0,0 +1,275 @@
+/**
+ * ==================================================================
+ * Button Input
+ * ==================================================================
+ *
+ * SW1 (PF4) and SW2 (PF0) are active low and interrupt on both edges.
+ * The first edge is reported straight away and the pin's interrupt is
+ * masked; Timer 0A then ignores the bounce for DEBOUNCE_MS before
+ * re-checking the pin and unmasking it. While a button is down the timer
+ * also generates HOLD and REPEAT events.
+ *
+ * Events go into a single-producer, single-consumer ring buffer. Both
+ * interrupts run at the same priority, so they never preempt each other
+ * and together act as the single producer. The game loop is the consumer.
+ * During a replay the interrupts stop queueing events and the replay,
+ * running in the game loop, becomes the producer instead.
+ *
+ * Only the pins and interrupts need the TM4C123. Host builds have no
+ * buttons, so their queue is fed by replays alone.
+ *
+ * ==================================================================
+ * ==================================================================
+ */
+
+#include "input.h"
+#include "timer.h"
+#include "replay.h"
+
+#ifdef PART_TM4C123GH6PM
+#include "tm4c123gh6pm.h"
+#endif
+
+#define PORT_F (1 << 5)
+#define TIMER_0 (1 << 0)
+#define SW1 (1 << 4)
+#define SW2 (1 << 0)
+#define BUTTONS (SW1 | SW2)
+
+#define TAEN (1 << 0) // Timer A Enable
+#define TATOIM (1 << 0) // Timer A Time-Out Interrupt Mask
+#define PERIODIC_MODE (0x2)
+
+#define NVIC_BIT(interrupt) (1UL << ((interrupt) - 16)) // Bit of an interrupt in NVIC_EN0
+#define INPUT_PRIORITY (2)
+
+const uint8_t buttonPins[numOfButtons] = { SW1, SW2 };
+
+InputEvent inputQueue[INPUT_QUEUE_SIZE];
+volatile uint8_t inputHead; // Written only by the interrupts
+volatile uint8_t inputTail; // Written only by the game loop
+uint32_t inputEventsDropped;
+
+volatile uint8_t inputReplaying; // Button interrupts do not queue events
+
+uint8_t buttonDown[numOfButtons]; // Debounced state of the pins
+uint8_t buttonState[numOfButtons]; // State as seen by the game, from the events taken
+uint8_t lockout[numOfButtons]; // Remaining debounce time in ms
+uint16_t heldTime[numOfButtons]; // Time down in ms
+
+/**
+ * Adds an event to the queue
+ * Must only be called by the current producer: the button interrupts, or the replay
+ */
+void pushInputEvent(InputEventType type, Button button, uint32_t time)
+{
+    uint8_t head = inputHead;
+    if ((uint8_t) (head - inputTail) >= INPUT_QUEUE_SIZE)
+    {
+        inputEventsDropped++;
+        return;
+    }
+    inputQueue[head & (INPUT_QUEUE_SIZE - 1)].time = time;
+    inputQueue[head & (INPUT_QUEUE_SIZE - 1)].type = type;
+    inputQueue[head & (INPUT_QUEUE_SIZE - 1)].button = button;
+    inputHead = head + 1; // Publish only after the event is written
+}
+
+/**
+ * Takes the oldest event off the queue
+ * Returns 0 if there are no events
+ */
+int getInputEvent(InputEvent *event)
+{
+    uint8_t tail = inputTail;
+    if (tail == inputHead)
+    {
+        return 0;
+    }
+    *event = inputQueue[tail & (INPUT_QUEUE_SIZE - 1)];
+    inputTail = tail + 1;
+
+    if (event->type == BUTTON_PRESS)
+    {
+        buttonState[event->button] = 1;
+    }
+    else if (event->type == BUTTON_RELEASE)
+    {
+        buttonState[event->button] = 0;
+    }
+    recordInputEvent(event);
+    return 1;
+}
+
+/**
+ * Whether the button is down, as of the last event taken off the queue
+ */
+int isButtonDown(Button button)
+{
+    return buttonState[button];
+}
+
+/**
+ * Switches the queue between the button interrupts and a replay
+ * Starting a replay discards any live events still queued
+ */
+void setInputReplaying(int replaying)
+{
+    uint8_t i;
+    if (replaying && !inputReplaying)
+    {
+        inputTail = inputHead;
+        for (i = 0; i < numOfButtons; i++)
+        {
+            buttonState[i] = 0;
+        }
+    }
+    inputReplaying = replaying;
+}
+
+/**
+ * Queues an event from the buttons unless a replay is running
+ */
+void reportInputEvent(InputEventType type, Button button, uint32_t time)
+{
+    if (!inputReplaying)
+    {
+        pushInputEvent(type, button, time);
+    }
+}
+
+#ifdef PART_TM4C123GH6PM
+
+/**
+ * Reports a change of the debounced state and starts ignoring the bounce
+ */
+void changeButton(Button button, uint8_t down, uint32_t time)
+{
+    buttonDown[button] = down;
+    heldTime[button] = 0;
+    lockout[button] = DEBOUNCE_MS;
+    reportInputEvent(down ? BUTTON_PRESS : BUTTON_RELEASE, button, time);
+    TIMER0_CTL_R |= TAEN;
+}
+
+void GPIOPortF_Handler()
+{
+    uint32_t time = getTime();
+    uint32_t pins = GPIO_PORTF_MIS_R;
+    uint8_t i, down;
+
+    GPIO_PORTF_ICR_R = pins;
+    for (i = 0; i < numOfButtons; i++)
+    {
+        if (pins & buttonPins[i])
+        {
+            GPIO_PORTF_IM_R &= ~buttonPins[i]; // Ignore the bounce
+            down = (GPIO_PORTF_DATA_R & buttonPins[i]) == 0;
+            if (down != buttonDown[i])
+            {
+                changeButton((Button) i, down, time);
+            }
+            else
+            {
+                lockout[i] = DEBOUNCE_MS;
+                TIMER0_CTL_R |= TAEN;
+            }
+        }
+    }
+}
+
+void Timer0A_Handler()
+{
+    uint32_t time = getTime();
+    uint8_t i, down, busy = 0;
+
+    TIMER0_ICR_R = TATOIM;
+    for (i = 0; i < numOfButtons; i++)
+    {
+        if (lockout[i] > 0)
+        {
+            lockout[i] = (lockout[i] > INPUT_TICK_MS) ? lockout[i] - INPUT_TICK_MS : 0;
+            if (lockout[i] == 0)
+            {
+                down = (GPIO_PORTF_DATA_R & buttonPins[i]) == 0;
+                if (down != buttonDown[i])
+                { // Changed again while it was being ignored
+                    changeButton((Button) i, down, time);
+                }
+                else
+                {
+                    GPIO_PORTF_ICR_R = buttonPins[i];
+                    GPIO_PORTF_IM_R |= buttonPins[i];
+                }
+            }
+        }
+
+        if (buttonDown[i])
+        {
+            heldTime[i] += INPUT_TICK_MS;
+            if (heldTime[i] == HOLD_MS)
+            {
+                reportInputEvent(BUTTON_HOLD, (Button) i, time);
+            }
+            else if (heldTime[i] == HOLD_MS + REPEAT_MS)
+            {
+                reportInputEvent(BUTTON_REPEAT, (Button) i, time);
+                heldTime[i] = HOLD_MS; // Keep repeating without overflowing
+            }
+        }
+        busy |= buttonDown[i] || lockout[i];
+    }
+
+    if (!busy)
+    {
+        TIMER0_CTL_R &= ~TAEN; // Nothing to time until the next edge
+    }
+}
+
+/**
+ * SW1 and SW2 interrupt on both edges; Timer 0A is the debounce timer
+ * PF0 is locked as an NMI pin by default and must be unlocked first
+ */
+void initInput()
+{
+    SYSCTL_RCGCGPIO_R |= PORT_F;
+    SYSCTL_RCGCTIMER_R |= TIMER_0;
+    while ((SYSCTL_PRGPIO_R & PORT_F) == 0)
+    {
+    }
+
+    GPIO_PORTF_LOCK_R = GPIO_LOCK_KEY;
+    GPIO_PORTF_CR_R |= SW2;
+    GPIO_PORTF_DIR_R &= ~BUTTONS; // Inputs
+    GPIO_PORTF_AFSEL_R &= ~BUTTONS;
+    GPIO_PORTF_PUR_R |= BUTTONS; // Buttons pull to ground
+    GPIO_PORTF_DEN_R |= BUTTONS;
+
+    GPIO_PORTF_IM_R &= ~BUTTONS; // Mask while configuring
+    GPIO_PORTF_IS_R &= ~BUTTONS; // Edge sensitive
+    GPIO_PORTF_IBE_R |= BUTTONS; // Both edges
+    GPIO_PORTF_ICR_R = BUTTONS;
+    GPIO_PORTF_IM_R |= BUTTONS;
+
+    while ((SYSCTL_PRTIMER_R & TIMER_0) == 0)
+    {
+    }
+    TIMER0_CTL_R &= ~TAEN;
+    TIMER0_CFG_R = 0x0; // 32-bit timer
+    TIMER0_TAMR_R = PERIODIC_MODE;
+    TIMER0_TAILR_R = INPUT_TICK_MS * CYCLES_PER_MS - 1;
+    TIMER0_ICR_R = TATOIM;
+    TIMER0_IMR_R |= TATOIM;
+
+    NVIC_PRI7_R = (NVIC_PRI7_R & ~0x00E00000) | (INPUT_PRIORITY << 21); // GPIO Port F
+    NVIC_PRI4_R = (NVIC_PRI4_R & ~0xE0000000) | (INPUT_PRIORITY << 29); // Timer 0A
+    NVIC_EN0_R = NVIC_BIT(INT_GPIOF) | NVIC_BIT(INT_TIMER0A);
+}
+
+#else
+
+void initInput()
+{
+}
+
+#endif
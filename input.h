@@ -0,0 +1,50 @@
+#ifndef INPUT_H
+#define INPUT_H
+
+#include <stdint.h>
+
+/**
+ * ==================================================================
+ * Buttons
+ * ==================================================================
+ */
+
+typedef enum
+{
+    BUTTON_SW1, BUTTON_SW2, numOfButtons
+} Button;
+
+typedef enum
+{
+    BUTTON_PRESS, BUTTON_RELEASE, BUTTON_HOLD, BUTTON_REPEAT
+} InputEventType;
+
+typedef struct InputEvents {
+    uint32_t time; // getTime() when the event happened
+    uint8_t type; // InputEventType
+    uint8_t button;
+} InputEvent;
+
+enum
+{
+    INPUT_QUEUE_SIZE = 16, // Must be a power of 2
+    INPUT_TICK_MS = 5, // Debounce timer period
+    DEBOUNCE_MS = 20, // Edges are ignored for this long after each change
+    HOLD_MS = 500,
+    REPEAT_MS = 100
+};
+
+extern uint32_t inputEventsDropped;
+
+/* ================================================================== */
+
+void initInput();
+int getInputEvent(InputEvent *event);
+int isButtonDown(Button button);
+void pushInputEvent(InputEventType type, Button button, uint32_t time);
+void setInputReplaying(int replaying);
+
+void GPIOPortF_Handler();
+void Timer0A_Handler();
+
+#endif // INPUT_H
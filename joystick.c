@@ -0,0 +1,210 @@
+/**
+ * ==================================================================
+ * Analog Joystick
+ * ==================================================================
+ *
+ * Timer 2A triggers ADC0 sample sequencer 2, which converts X then Y with
+ * 64x hardware averaging. The end-of-sequence interrupt low-pass filters
+ * both axes and writes them, packed into one word, to the back half of a
+ * double buffer before flipping it to the front. readJoystick only ever
+ * loads the front word, so the game loop never waits on a conversion.
+ *
+ * Host builds have no joystick and always read it centred.
+ *
+ * ==================================================================
+ * ==================================================================
+ */
+
+#ifdef PART_TM4C123GH6PM
+#include "tm4c123gh6pm.h"
+#endif
+#include "joystick.h"
+#include "timer.h"
+
+#define PORT_E (1 << 4)
+#define TIMER_2 (1 << 2)
+#define ADC_0 (1 << 0)
+#define AIN0 (1 << 3) // PE3
+#define AIN1 (1 << 2) // PE2
+
+#define SS2 (1 << 2) // Sample Sequencer 2
+#define EMUX_TIMER (0x5 << 8) // SS2 triggered by a timer
+#define END1 (1 << 5) // Step 1 ends the sequence
+#define IE1 (1 << 6) // Step 1 raises the interrupt
+#define AVERAGE_64 (0x6)
+
+#define TAEN (1 << 0) // Timer A Enable
+#define TAOTE (1 << 5) // Timer A triggers the ADC
+#define PERIODIC_MODE (0x2)
+
+#define NVIC_BIT(interrupt) (1UL << ((interrupt) - 16))
+#define JOYSTICK_PRIORITY (3)
+
+#define ADC_MAX (4095)
+#define PACK(x, y) (((uint32_t) (x) << 16) | (y))
+
+// Filtered X and Y with 4 fractional bits, packed into one word
+uint32_t joystickBuffer[2];
+volatile uint8_t joystickFront;
+
+uint16_t filterX, filterY; // Filter state, with 4 fractional bits
+
+typedef struct Axes {
+    uint16_t centre;
+    uint16_t deadZone;
+    uint32_t sum; // Calibration samples
+    uint16_t low, high;
+} Axis;
+
+Axis axisX, axisY;
+volatile uint8_t calibrationCount;
+
+/**
+ * Adds a resting sample to the calibration
+ * The centre is the mean; the dead zone covers the noise seen plus a margin
+ */
+void calibrateAxis(Axis *axis, uint16_t value)
+{
+    if (calibrationCount == CALIBRATION_SAMPLES)
+    {
+        axis->sum = 0;
+        axis->low = value;
+        axis->high = value;
+    }
+    axis->sum += value;
+    if (value < axis->low)
+    {
+        axis->low = value;
+    }
+    if (value > axis->high)
+    {
+        axis->high = value;
+    }
+    if (calibrationCount == 1)
+    {
+        axis->centre = axis->sum / CALIBRATION_SAMPLES;
+        axis->deadZone = (axis->high - axis->low) + DEAD_ZONE;
+    }
+}
+
+#ifdef PART_TM4C123GH6PM
+
+void ADC0Seq2_Handler()
+{
+    uint16_t x = ADC0_SSFIFO2_R & 0xFFF;
+    uint16_t y = ADC0_SSFIFO2_R & 0xFFF;
+
+    ADC0_ISC_R = SS2;
+
+    filterX += ((int32_t) (x << 4) - filterX) >> FILTER_SHIFT;
+    filterY += ((int32_t) (y << 4) - filterY) >> FILTER_SHIFT;
+
+    joystickBuffer[joystickFront ^ 1] = PACK(filterX, filterY);
+    joystickFront ^= 1;
+
+    if (calibrationCount > 0)
+    {
+        calibrateAxis(&axisX, x);
+        calibrateAxis(&axisY, y);
+        calibrationCount--;
+    }
+}
+
+#endif
+
+/**
+ * Takes the centre from the next few samples; the stick must be at rest
+ * Returns straight away; the interrupt finishes the calibration
+ */
+void calibrateJoystick()
+{
+    calibrationCount = CALIBRATION_SAMPLES;
+}
+
+/**
+ * Maps one axis to -127 to 127 around its centre, with a dead zone
+ */
+int8_t scaleAxis(const Axis *axis, int32_t value)
+{
+    int32_t high = axis->centre + axis->deadZone;
+    int32_t low = axis->centre - axis->deadZone;
+    if (value > high)
+    {
+        return (high < ADC_MAX) ? (value - high) * 127 / (ADC_MAX - high) : 127;
+    }
+    if (value < low)
+    {
+        return (low > 0) ? -((low - value) * 127 / low) : -127;
+    }
+    return 0;
+}
+
+/**
+ * Latest filtered position, from -127 (left / up) to 127 (right / down)
+ * Reads 0 until the calibration has finished
+ */
+void readJoystick(int8_t *x, int8_t *y)
+{
+    uint32_t sample = joystickBuffer[joystickFront];
+    if (calibrationCount > 0)
+    {
+        *x = 0;
+        *y = 0;
+        return;
+    }
+    *x = scaleAxis(&axisX, (sample >> 16) >> 4);
+    *y = scaleAxis(&axisY, (sample & 0xFFFF) >> 4);
+}
+
+#ifdef PART_TM4C123GH6PM
+
+void initJoystick()
+{
+    SYSCTL_RCGCGPIO_R |= PORT_E;
+    SYSCTL_RCGCADC_R |= ADC_0;
+    SYSCTL_RCGCTIMER_R |= TIMER_2;
+    while ((SYSCTL_PRGPIO_R & PORT_E) == 0)
+    {
+    }
+
+    GPIO_PORTE_DIR_R &= ~(AIN0 | AIN1);
+    GPIO_PORTE_AFSEL_R |= (AIN0 | AIN1);
+    GPIO_PORTE_DEN_R &= ~(AIN0 | AIN1);
+    GPIO_PORTE_AMSEL_R |= (AIN0 | AIN1); // Analog function
+
+    filterX = (ADC_MAX / 2) << 4;
+    filterY = (ADC_MAX / 2) << 4;
+    calibrateJoystick();
+
+    while ((SYSCTL_PRADC_R & ADC_0) == 0)
+    {
+    }
+    ADC0_ACTSS_R &= ~SS2; // Disable while configuring
+    ADC0_EMUX_R = (ADC0_EMUX_R & ~0x0F00) | EMUX_TIMER;
+    ADC0_SSMUX2_R = (0 << 0) | (1 << 4); // AIN0 then AIN1
+    ADC0_SSCTL2_R = END1 | IE1;
+    ADC0_SAC_R = AVERAGE_64;
+    ADC0_ISC_R = SS2;
+    ADC0_IM_R |= SS2;
+    ADC0_ACTSS_R |= SS2;
+
+    NVIC_PRI4_R = (NVIC_PRI4_R & ~0x000000E0) | (JOYSTICK_PRIORITY << 5); // ADC0 SS2
+    NVIC_EN0_R = NVIC_BIT(INT_ADC0SS2);
+
+    while ((SYSCTL_PRTIMER_R & TIMER_2) == 0)
+    {
+    }
+    TIMER2_CTL_R &= ~TAEN;
+    TIMER2_CFG_R = 0x0; // 32-bit timer
+    TIMER2_TAMR_R = PERIODIC_MODE;
+    TIMER2_TAILR_R = JOYSTICK_PERIOD_MS * CYCLES_PER_MS - 1;
+    TIMER2_CTL_R |= TAOTE | TAEN;
+}
+
+#else
+
+void initJoystick()
+{
+}
+
+#endif
@@ -0,0 +1,31 @@
+#ifndef JOYSTICK_H
+#define JOYSTICK_H
+
+#include <stdint.h>
+
+/**
+ * ==================================================================
+ * Analog Joystick
+ * ==================================================================
+ *
+ * X: PE3 (AIN0)
+ * Y: PE2 (AIN1)
+ */
+
+enum
+{
+    JOYSTICK_PERIOD_MS = 2, // Timer 2A triggers a conversion of both axes this often
+    CALIBRATION_SAMPLES = 16,
+    DEAD_ZONE = 100, // ADC counts added to the resting noise to get the dead zone
+    FILTER_SHIFT = 2 // Each new sample moves the filtered value 1/4 of the way
+};
+
+/* ================================================================== */
+
+void initJoystick();
+void calibrateJoystick();
+void readJoystick(int8_t *x, int8_t *y);
+
+void ADC0Seq2_Handler();
+
+#endif // JOYSTICK_H
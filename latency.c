@@ -0,0 +1,74 @@
+/**
+ * ==================================================================
+ * Input-to-Display Latency
+ * ==================================================================
+ *
+ * Event times wait in a small queue until a display update has sent its
+ * last byte, then each latency is added to a 1 ms histogram.
+ *
+ * ==================================================================
+ * ==================================================================
+ */
+
+#include "latency.h"
+#include "timer.h"
+
+LatencyStat latencyStats = { 0, 0, 0xFFFFFFFF, 0, 0, { 0 } };
+
+uint32_t pendingTimes[MAX_PENDING_LATENCIES];
+uint8_t pendingLatencies;
+
+/**
+ * Marks the event as shown by the next display update
+ */
+void trackLatency(const InputEvent *event)
+{
+    if (pendingLatencies >= MAX_PENDING_LATENCIES)
+    {
+        latencyStats.dropped++;
+        return;
+    }
+    pendingTimes[pendingLatencies++] = event->time;
+}
+
+/**
+ * Called by updateDisplay once the data has been sent
+ */
+void completeLatency(uint32_t time)
+{
+    uint32_t latency, bucket;
+    uint8_t i;
+
+    for (i = 0; i < pendingLatencies; i++)
+    {
+        latency = time - pendingTimes[i];
+        bucket = latency / CYCLES_PER_MS;
+        latencyStats.histogram[(bucket < LATENCY_BUCKETS) ? bucket : LATENCY_BUCKETS - 1]++;
+        latencyStats.count++;
+        latencyStats.total += latency;
+        if (latency < latencyStats.min)
+        {
+            latencyStats.min = latency;
+        }
+        if (latency > latencyStats.max)
+        {
+            latencyStats.max = latency;
+        }
+    }
+    pendingLatencies = 0;
+}
+
+void resetLatency()
+{
+    uint8_t i;
+    latencyStats.count = 0;
+    latencyStats.dropped = 0;
+    latencyStats.min = 0xFFFFFFFF;
+    latencyStats.max = 0;
+    latencyStats.total = 0;
+    for (i = 0; i < LATENCY_BUCKETS; i++)
+    {
+        latencyStats.histogram[i] = 0;
+    }
+    pendingLatencies = 0;
+}
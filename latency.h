@@ -0,0 +1,40 @@
+#ifndef LATENCY_H
+#define LATENCY_H
+
+#include <stdint.h>
+#include "input.h"
+
+/**
+ * ==================================================================
+ * Input-to-Display Latency
+ * ==================================================================
+ *
+ * Call trackLatency(&event) when the game changes the frame buffer because
+ * of an input event. The next updateDisplay() that sends data completes it,
+ * and the time from the event to the last byte leaving SSI is added to the
+ * histogram. Read latencyStats from the debugger.
+ */
+
+enum
+{
+    LATENCY_BUCKETS = 32, // 1 ms each; the last bucket holds everything slower
+    MAX_PENDING_LATENCIES = 4
+};
+
+typedef struct LatencyStats {
+    uint32_t count;
+    uint32_t dropped; // Events tracked while MAX_PENDING_LATENCIES were waiting
+    uint32_t min, max, total; // Bus clock cycles
+    uint16_t histogram[LATENCY_BUCKETS];
+} LatencyStat;
+
+extern LatencyStat latencyStats;
+extern uint8_t pendingLatencies;
+
+/* ================================================================== */
+
+void trackLatency(const InputEvent *event);
+void completeLatency(uint32_t time);
+void resetLatency();
+
+#endif // LATENCY_H
@@ -0,0 +1,256 @@
+/**
+ * ==================================================================
+ * Parallax Layers
+ * ==================================================================
+ *
+ * Layers scroll at their own fraction of the camera's speed and are
+ * merged back to front: each layer clears its mask from what is behind
+ * it and ORs in its pixels. Only columns marked by invalidateLayers() or
+ * by a layer moving are merged again.
+ *
+ * Layers are packed 4 columns to a word, so the masks and ORs are done
+ * a word at a time. A layer scrolled by a number of columns that is not
+ * a multiple of 4 is read by shifting two neighbouring words together.
+ *
+ * A scrolled level is the playfield: it is ORed over the layers. The
+ * merged columns go into spriteBackground and are handed to
+ * renderSprites(), which draws the sprites over them and marks them
+ * dirty, so each frame is composeLayers() then renderSprites().
+ *
+ * HUD:
+ * The HUD is the top layer. It is drawn once into the frame buffer and
+ * cacheHud() keeps those banks as a bitmap with a mask of its pixels
+ * grown by one pixel all round, so the HUD shows over the playfield with
+ * a clear outline and is transparent everywhere else. composeHud() lays
+ * it over whatever is dirty in its banks, last before updateDisplay():
+ * composeLayers(), renderSprites(), anything else, composeHud().
+ *
+ * ==================================================================
+ * ==================================================================
+ */
+
+#include "layers.h"
+#include "scroll.h"
+#include "sprite.h"
+
+Layer layers[MAX_LAYERS];
+
+uint8_t layerStart[BANKS] = { COLS, COLS, COLS, COLS, COLS, COLS };
+uint8_t layerEnd[BANKS];
+uint8_t hudBits[BANKS][COLS];
+uint8_t hudMask[BANKS][COLS];
+uint8_t hudBanks; // Bit per bank the HUD covers
+uint32_t layerRow[LAYER_WORDS];
+
+void setLayer(uint8_t i, const LayerImage *image, uint8_t top, Fixed8 speed)
+{
+    uint8_t bank;
+    layers[i].image = image;
+    layers[i].top = top;
+    layers[i].speed = speed;
+    layers[i].x = 0;
+    for (bank = 0; bank < BANKS; bank++)
+    {
+        invalidateLayers(0, bank, COLS);
+    }
+}
+
+/**
+ * Marks columns to be merged again by composeLayers()
+ */
+void invalidateLayers(uint8_t x, uint8_t bank, uint8_t width)
+{
+    if ((x >= COLS) || (bank >= BANKS) || (width == 0))
+    {
+        return;
+    }
+    if (x < layerStart[bank])
+    {
+        layerStart[bank] = x;
+    }
+    if (x + width > layerEnd[bank])
+    {
+        layerEnd[bank] = (x + width > COLS) ? COLS : x + width;
+    }
+}
+
+/**
+ * Moves each layer to its share of the camera position
+ * The banks of a layer that moved are merged again
+ */
+void scrollLayers(int16_t cameraX)
+{
+    uint8_t i, bank;
+    int16_t x;
+    Layer *layer;
+
+    for (i = 0; i < MAX_LAYERS; i++)
+    {
+        layer = &layers[i];
+        if (!layer->image)
+        {
+            continue;
+        }
+        x = (int16_t) (((int32_t) cameraX * layer->speed) >> 8);
+        if (x != layer->x)
+        {
+            layer->x = x;
+            for (bank = layer->top; bank < layer->top + layer->image->banks; bank++)
+            {
+                invalidateLayers(0, bank, COLS);
+            }
+        }
+    }
+}
+
+/**
+ * Keeps banks [top, top + banks) of the frame buffer as the HUD
+ * The columns under it are redrawn by renderSprites() and covered again
+ */
+void cacheHud(uint8_t top, uint8_t banks)
+{
+    uint8_t bank, x, bits, previous, current;
+    uint8_t end = (top + banks < BANKS) ? top + banks : BANKS;
+
+    hudBanks = 0;
+    for (bank = 0; bank < BANKS; bank++)
+    {
+        for (x = 0; x < COLS; x++)
+        {
+            hudBits[bank][x] = (bank >= top && bank < end) ? frameBuffer[bank][x] : 0;
+        }
+    }
+    for (bank = top; bank < end; bank++)
+    {
+        for (x = 0; x < COLS; x++) // Grow the pixels up and down
+        {
+            bits = hudBits[bank][x];
+            bits |= (uint8_t) (bits << 1) | (bits >> 1);
+            if (bank > top)
+            {
+                bits |= hudBits[bank - 1][x] >> 7;
+            }
+            if (bank + 1 < end)
+            {
+                bits |= (uint8_t) (hudBits[bank + 1][x] << 7);
+            }
+            hudMask[bank][x] = bits;
+        }
+        previous = 0;
+        for (x = 0; x < COLS; x++) // Then left and right
+        {
+            current = hudMask[bank][x];
+            hudMask[bank][x] = previous | current
+                    | ((x + 1 < COLS) ? hudMask[bank][x + 1] : 0);
+            previous = current;
+        }
+        hudBanks |= 1 << bank;
+        invalidateSprites(0, bank, COLS);
+    }
+}
+
+/**
+ * 4 columns of one bank row of a layer, starting at any column
+ */
+uint32_t getLayerWord(const uint32_t *row, uint8_t words, uint16_t column)
+{
+    uint8_t i = column >> 2, shift = (column & 3) * 8;
+    if (shift == 0)
+    {
+        return row[i];
+    }
+    return (row[i] >> shift) | (row[(i + 1 < words) ? i + 1 : 0] << (32 - shift));
+}
+
+/**
+ * Merges the layers and the level in the invalidated columns into the
+ * background of the sprites
+ */
+void composeLayers()
+{
+    uint8_t bank, i, word, first, last, row;
+    uint16_t width, column;
+    const Layer *layer;
+    const LayerImage *image;
+    uint32_t bits;
+
+    for (bank = 0; bank < BANKS; bank++)
+    {
+        if (layerStart[bank] >= layerEnd[bank])
+        {
+            layerStart[bank] = COLS;
+            layerEnd[bank] = 0;
+            continue;
+        }
+        first = layerStart[bank] >> 2;
+        last = (layerEnd[bank] + 3) >> 2;
+        for (word = first; word < last; word++)
+        {
+            layerRow[word] = 0;
+        }
+
+        for (i = 0; i < MAX_LAYERS; i++)
+        {
+            layer = &layers[i];
+            image = layer->image;
+            if (!image || (bank < layer->top) || (bank >= layer->top + image->banks))
+            {
+                continue;
+            }
+            row = bank - layer->top;
+            width = image->words * 4;
+            column = (uint16_t) (((layer->x + first * 4) % width + width) % width);
+            for (word = first; word < last; word++)
+            {
+                if (image->mask)
+                {
+                    layerRow[word] &= ~getLayerWord(image->mask + row * image->words,
+                                                    image->words, column);
+                }
+                layerRow[word] |= getLayerWord(image->bits + row * image->words,
+                                               image->words, column);
+                column = (column + 4 < width) ? column + 4 : column + 4 - width;
+            }
+        }
+        if (scrollLevel)
+        {
+            for (word = first; word < last; word++)
+            {
+                layerRow[word] |= getScrollWord(bank, word * 4);
+            }
+        }
+
+        for (word = first; word < last; word++)
+        {
+            bits = layerRow[word];
+            spriteBackground[bank][word * 4] = (uint8_t) bits;
+            spriteBackground[bank][word * 4 + 1] = (uint8_t) (bits >> 8);
+            spriteBackground[bank][word * 4 + 2] = (uint8_t) (bits >> 16);
+            spriteBackground[bank][word * 4 + 3] = (uint8_t) (bits >> 24);
+        }
+        invalidateSprites(first * 4, bank, (last - first) * 4);
+        layerStart[bank] = COLS;
+        layerEnd[bank] = 0;
+    }
+}
+
+/**
+ * Lays the HUD over the dirty columns of its banks
+ */
+void composeHud()
+{
+    uint8_t bank, x;
+
+    for (bank = 0; bank < BANKS; bank++)
+    {
+        if (!(hudBanks & (1 << bank)))
+        {
+            continue;
+        }
+        for (x = dirtyStart[bank]; x < dirtyEnd[bank]; x++)
+        {
+            frameBuffer[bank][x] = (frameBuffer[bank][x] & ~hudMask[bank][x])
+                    | hudBits[bank][x];
+        }
+    }
+}
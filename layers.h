@@ -0,0 +1,51 @@
+#ifndef LAYERS_H
+#define LAYERS_H
+
+#include <stdint.h>
+#include "lcd.h"
+#include "fixed.h"
+
+/**
+ * ==================================================================
+ * Parallax Layers
+ * ==================================================================
+ */
+
+enum
+{
+    MAX_LAYERS = 4, // Drawn back to front
+    LAYER_WORDS = COLS / 4 // Words in a bank of the display
+};
+
+/**
+ * Bank layout packed 4 columns to a word, the first column in the low byte
+ * Each bank row is words long, and the image repeats every words * 4 columns
+ */
+typedef struct LayerImages {
+    const uint32_t *bits;
+    const uint32_t *mask; // Pixels cleared from the layers behind; 0: none
+    uint8_t words;
+    uint8_t banks;
+} LayerImage;
+
+typedef struct Layers {
+    const LayerImage *image; // 0: unused
+    uint8_t top; // Bank of the display the image starts at
+    Fixed8 speed; // Fraction of the camera's movement; 0 for a fixed backdrop
+    int16_t x; // Image column at the left edge of the display
+} Layer;
+
+extern Layer layers[MAX_LAYERS];
+extern uint8_t hudBits[BANKS][COLS];
+extern uint8_t hudMask[BANKS][COLS]; // Pixels the HUD covers
+
+/* ================================================================== */
+
+void setLayer(uint8_t i, const LayerImage *image, uint8_t top, Fixed8 speed);
+void invalidateLayers(uint8_t x, uint8_t bank, uint8_t width);
+void scrollLayers(int16_t cameraX);
+void cacheHud(uint8_t top, uint8_t banks);
+void composeLayers();
+void composeHud();
+
+#endif // LAYERS_H
@@ -9,31 +9,48 @@
  * Data is displayed from LSB (top) to MSB (bottom).
  * (see Fig.3, 4, 5, and 6 of the pcd8544 Data Sheet)
  *
+ * Frame Buffer:
+ * Drawing functions write into frameBuffer, which has the same bank layout as the display,
+ * and mark the columns they touch as dirty. updateDisplay() sends only the dirty columns.
+ *
+ * Host builds have no display: the frame buffer is drawn as usual and the bytes that would
+ * be sent are only counted.
+ *
  * ==================================================================
  * ==================================================================
  */
 
+#ifdef PART_TM4C123GH6PM
 #include "tm4c123gh6pm.h"
+#endif
+#include "lcd.h"
+#include "timer.h"
+#include "text.h"
+#include "latency.h"
+#include "bundle.h"
 
-// Add desired fonts here
+// Add desired fonts here; their columns are in the asset bundle
 #include "Fonts/regular.h"
 #include "Fonts/cursive.h"
 #include "Fonts/bold.h"
-
-#include "lcd.h"
-#include "timer.h"
+#include "Fonts/large.h"
+#include "Fonts/giant.h"
 
 #define PORT_A (1) // SSI0
 #define GPIOPCTL (2)
 #define FIFO_NOT_EMPTY ((SSI0_SR_R & (1<<0)) == 0) // The transmit FIFO is not empty
+#define FIFO_FULL ((SSI0_SR_R & (1<<1)) == 0) // The transmit FIFO is full
+#define SSI_BUSY ((SSI0_SR_R & (1<<4)) != 0) // A frame is still being shifted out
 
 Font currentFont;
 
-enum
-{
-    COLS = 84, ROWS = 48
-};
-// LCD Screen Size
+uint8_t frameBuffer[BANKS][COLS];
+
+// Columns [dirtyStart, dirtyEnd) of each bank have changed since the last update
+uint8_t dirtyStart[BANKS] = { COLS, COLS, COLS, COLS, COLS, COLS };
+uint8_t dirtyEnd[BANKS];
+
+uint32_t bytesTransmitted; // Every command and data byte sent over SSI
 
 /**
  * ==================================================================
@@ -90,109 +107,19 @@ enum
 /* ================================================================== */
 
 /**
- * Maps the index for each character per fontType
- * !!! Warning: If any font headers change, this array must change as well
+ * Every font indexed by its fontType, and the name of its columns in the asset bundle
+ * !!! Warning: If any fonts are added, these arrays must change as well
  */
-const uint8_t textMap[][numOfFonts] =
-{       { 0, 0, 0 }, // Space
-        { 0, 0, 0 }, // !
-        { 0, 0, 0 }, // "
-        { 0, 0, 0 }, // #
-        { 0, 0, 0 }, // $
-        { 0, 0, 0 }, // %
-        { 0, 0, 0 }, // &
-        { 0, 0, 0 }, // '
-        { 0, 0, 0 }, // (
-        { 0, 0, 0 }, // )
-        { 0, 0, 0 }, // *
-        { 0, 0, 0 }, // +
-        { 0, 0, 0 }, // ,
-        { 0, 0, 0 }, // -
-        { 0, 0, 0 }, // .
-        { 0, 0, 0 }, // /
-        { 0, 0, 0 }, // 0
-        { 0, 0, 0 }, // 1
-        { 0, 0, 0 }, // 2
-        { 0, 0, 0 }, // 3
-        { 0, 0, 0 }, // 4
-        { 0, 0, 0 }, // 5
-        { 0, 0, 0 }, // 6
-        { 0, 0, 0 }, // 7
-        { 0, 0, 0 }, // 8
-        { 0, 0, 0 }, // 9
-        { 0, 0, 0 }, // :
-        { 0, 0, 0 }, // ;
-        { 0, 0, 0 }, // <
-        { 0, 0, 0 }, // =
-        { 0, 0, 0 }, // >
-        { 0, 0, 0 }, // ?
-        { 0, 0, 0 }, // @
-        { 0, 2, 0 }, // A
-        { 0, 0, 0 }, // B
-        { 0, 0, 0 }, // C
-        { 0, 0, 0 }, // D
-        { 0, 0, 0 }, // E
-        { 0, 0, 0 }, // F
-        { 0, 0, 0 }, // G
-        { 0, 0, 0 }, // H
-        { 0, 0, 0 }, // I
-        { 0, 0, 0 }, // J
-        { 0, 0, 0 }, // K
-        { 0, 0, 0 }, // L
-        { 0, 10, 0 }, // M
-        { 0, 0, 0 }, // N
-        { 0, 0, 0 }, // O
-        { 0, 0, 0 }, // P
-        { 0, 0, 0 }, // Q
-        { 0, 0, 0 }, // R
-        { 0, 0, 0 }, // S
-        { 0, 0, 0 }, // T
-        { 0, 0, 0 }, // U
-        { 0, 0, 0 }, // V
-        { 0, 0, 0 }, // W
-        { 0, 0, 0 }, // X
-        { 0, 0, 0 }, // Y
-        { 0, 0, 0 }, // Z
-        { 0, 0, 0 }, // [
-        { 0, 0, 0 }, // '\'
-        { 0, 0, 0 }, // ]
-        { 0, 0, 0 }, // ^
-        { 0, 0, 0 }, // _
-        { 0, 0, 0 }, // `
-        { 0, 22, 0 }, // a
-        { 0, 0, 0 }, // b
-        { 0, 0, 0 }, // c
-        { 0, 0, 0 }, // d
-        { 0, 0, 0 }, // e
-        { 0, 0, 0 }, // f
-        { 0, 0, 0 }, // g
-        { 0, 0, 0 }, // h
-        { 0, 28, 0 }, // i
-        { 0, 0, 0 }, // j
-        { 0, 0, 0 }, // k
-        { 0, 32, 0 }, // l
-        { 0, 0, 0 }, // m
-        { 0, 35, 0 }, // n
-        { 0, 41, 0 }, // o
-        { 0, 0, 0 }, // p
-        { 0, 0, 0 }, // q
-        { 0, 46, 0 }, // r
-        { 0, 52, 0 }, // s
-        { 0, 0, 0 }, // t
-        { 0, 0, 0 }, // u
-        { 0, 0, 0 }, // v
-        { 0, 0, 0 }, // w
-        { 0, 0, 0 }, // x
-        { 0, 0, 0 }, // y
-        { 0, 0, 0 }, // z
-        { 0, 0, 0 }, // {
-        { 0, 0, 0 }, // |
-        { 0, 0, 0 }, // }
-        { 0, 0, 0 }  // ~
-};
+Font *const fonts[numOfFonts] = { &regularFont, &cursiveFont, &boldFont, &largeFont, &giantFont };
+const char *const fontAssets[numOfFonts] = { "regular", "cursive", "bold", "large", "giant" };
+
+const Glyph blankGlyph = { 0, 0 };
+const uint8_t blankColumn = 0;
 
 /* ================================================================== */
 
+#ifdef PART_TM4C123GH6PM
+
 /**
  * RES pulse must be min 100ns within a maximum time of 100ms after VDD goes HIGH
  */
@@ -215,10 +142,47 @@ void transmitData(InstructionMode mode, uint8_t data)
         GPIO_PORTA_DATA_R &= ~DC;
     }
     SSI0_DR_R = data;
+    bytesTransmitted++;
     while (FIFO_NOT_EMPTY)
         ;
 }
 
+/**
+ * Sends consecutive data bytes, keeping the transmit FIFO full
+ */
+void transmitDataBuffer(const uint8_t data[], int size)
+{
+    int i;
+    GPIO_PORTA_DATA_R |= DC;
+    for (i = 0; i < size; i++)
+    {
+        while (FIFO_FULL)
+            ;
+        SSI0_DR_R = data[i];
+    }
+    bytesTransmitted += size;
+    while (SSI_BUSY) // D/C must not change until the last byte is out
+        ;
+}
+
+#else
+
+void reset()
+{
+}
+
+void transmitData(InstructionMode mode, uint8_t data)
+{
+    bytesTransmitted++;
+}
+
+void transmitDataBuffer(const uint8_t data[], int size)
+{
+    bytesTransmitted += size;
+}
+
+#endif
+
 void transmitBasicInstruction(BasicInstruction instruction)
 {
     transmitData(COMMAND_MODE, BASIC_INSTRUCTION);
@@ -240,25 +204,85 @@ void setAddress(uint8_t x, uint8_t y)
     }
 }
 
+/**
+ * Extends the dirty columns of a bank
+ */
+void markDirty(uint8_t x, uint8_t y, uint8_t width)
+{
+    if ((x >= COLS) || (y >= BANKS) || (width == 0))
+    {
+        return;
+    }
+    if (x < dirtyStart[y])
+    {
+        dirtyStart[y] = x;
+    }
+    if (x + width > dirtyEnd[y])
+    {
+        dirtyEnd[y] = (x + width > COLS) ? COLS : x + width;
+    }
+}
+
+/**
+ * Sends the dirty columns of each bank to the display
+ * A run that ends at the last column leaves the display at the start of the
+ * next bank, so a run from column 0 there needs no setAddress() and a whole
+ * frame goes in one pass
+ */
+void updateDisplay()
+{
+    uint8_t y, sent = 0, follows = 0;
+    for (y = 0; y < BANKS; y++)
+    {
+        if (dirtyStart[y] < dirtyEnd[y])
+        {
+            if (!follows || (dirtyStart[y] > 0))
+            {
+                setAddress(dirtyStart[y], y);
+            }
+            transmitDataBuffer(&frameBuffer[y][dirtyStart[y]],
+                               dirtyEnd[y] - dirtyStart[y]);
+            sent = 1;
+            follows = (dirtyEnd[y] == COLS);
+        }
+        else
+        {
+            follows = 0;
+        }
+        dirtyStart[y] = COLS;
+        dirtyEnd[y] = 0;
+    }
+    if (sent && pendingLatencies)
+    {
+        completeLatency(getTime());
+    }
+}
+
 void clearDisplay()
 {
-    setAddress(0, 0);
-    int i;
-    for (i = 0; i < COLS * (ROWS / 8); ++i)
+    uint8_t y, x;
+    for (y = 0; y < BANKS; y++)
     {
-        transmitData(DATA_MODE, 0x00);
+        for (x = 0; x < COLS; x++)
+        {
+            frameBuffer[y][x] = 0x00;
+        }
+        markDirty(0, y, COLS);
     }
+    updateDisplay();
 }
 
 /**
  * Draws a single dot on a column
- * Requires an address
  * offset (0-7): which of the 8 bits to draw
  */
 void drawPixel(uint8_t x, uint8_t y, uint8_t offset)
 {
-    setAddress(x, y);
-    transmitData(DATA_MODE, 1 << offset);
+    if ((x <= 83) && (y <= 5))
+    {
+        frameBuffer[y][x] |= 1 << offset;
+        markDirty(x, y, 1);
+    }
 }
 
 /**
@@ -278,88 +302,149 @@ uint8_t getVerticalData(uint8_t offset, uint8_t width)
 
 /**
  * Draws the given shape from left to right
- * Requires an address
  * offset (0-7): where to start drawing in the y-address
- * Returns x-address
  */
 void drawShape(uint8_t x, uint8_t y, uint8_t offset, const uint8_t shape[],
                int arraySize)
+{
+    drawBankedShape(x, y, offset, shape, arraySize, 1);
+}
+
+/**
+ * Draws a shape that is several banks tall, stored a bank at a time (top bank first)
+ * offset (0-7): where to start drawing in the y-address
+ */
+void drawBankedShape(uint8_t x, uint8_t y, uint8_t offset, const uint8_t shape[],
+                     int width, uint8_t banks)
 {
     if ((x <= 83) && (y <= 5))
     {
-        setAddress(x, y);
-
-        int i;
-        uint8_t data;
-
-        for (i = 0; i < arraySize; i++)
+        uint8_t bank;
+        rasterShape(&frameBuffer[0][0], COLS, BANKS, x, y, offset, shape, width,
+                    banks);
+        for (bank = 0; bank < banks + (offset != 0); bank++)
         {
-            data = shape[i] << offset;
+            markDirty(x, y + bank, (width > COLS) ? COLS : width);
+        }
+    }
+}
 
-            if (data != shape[i])
-            { // check if the drawing spills over into the next y-address
-                setAddress(x, y + 1);
-                transmitData(DATA_MODE, shape[i] >> offset);
-                setAddress(x, y);
-            }
+/**
+ * ORs a shape stored a bank at a time into any buffer with the display's bank layout
+ * Each bank of dest is written in a single pass; with an offset, a bank takes
+ * the bottom of the shape bank above it and the top of its own
+ * stride: columns in each bank of dest
+ * Columns left of 0 or right of stride are clipped
+ */
+void rasterShape(uint8_t dest[], uint8_t stride, uint8_t destBanks, int x,
+                 uint8_t y, uint8_t offset, const uint8_t shape[], int width,
+                 uint8_t banks)
+{
+    uint8_t bank, lastBank = (offset == 0) ? banks - 1 : banks;
+    const uint8_t *above, *below;
+    uint8_t *row;
+    int i, first = (x < 0) ? -x : 0;
+    int columns = (x + width > stride) ? stride - x : width;
 
-            transmitData(DATA_MODE, data);
-            x++;
+    for (bank = 0; (bank <= lastBank) && (y + bank < destBanks); bank++)
+    {
+        above = (bank > 0) ? shape + (bank - 1) * width : 0;
+        below = (bank < banks) ? shape + bank * width : 0;
+        row = dest + (y + bank) * stride;
+        for (i = first; i < columns; i++)
+        {
+            row[x + i] |= (uint8_t) (((below ? below[i] : 0) << offset)
+                    | ((above && offset) ? above[i] >> (8 - offset) : 0));
         }
     }
 }
 
+/**
+ * Rasterises the given characters into any buffer with the display's bank layout
+ * Returns the width of the text in pixels
+ */
+int rasterText(uint8_t dest[], uint8_t stride, uint8_t destBanks, uint8_t x,
+               uint8_t y, uint8_t offset, const char str[], int textSize,
+               TextFont fontType)
+{
+    const Font *font = fonts[fontType];
+    const Glyph *glyph;
+    uint8_t banks = (font->height + 7) >> 3;
+    int i, width = 0;
+    for (i = 0; (i < textSize) && (x + width < stride); i++)
+    {
+        glyph = getGlyph(font, str[i]);
+        rasterShape(dest, stride, destBanks, x + width, y, offset,
+                    font->fontPtr + glyph->offset, glyph->width, banks);
+        width += glyph->width;
+    }
+    return width;
+}
+
 /**
  * Draws the given characters in the given font
  */
-void drawText(uint8_t x, uint8_t y, uint8_t offset, char str[], int textSize,
+void drawText(uint8_t x, uint8_t y, uint8_t offset, const char str[], int textSize,
               TextFont fontType)
 {
     if ((x <= 83) && (y <= 5))
     {
-        setAddress(x, y);
-        int i, index, size;
-        for (i = 0; i < textSize; i++)
+        uint8_t bank, banks = (offset + fonts[fontType]->height + 7) >> 3;
+        int width = rasterText(&frameBuffer[0][0], COLS, BANKS, x, y, offset,
+                               str, textSize, fontType);
+        for (bank = 0; bank < banks; bank++)
         {
-            index = textMap[str[i] - 0x20][fontType]; // textMap[char][fontType]
-            size = *(currentFont.fontPtr + index);
-            drawShape(x, y, offset, currentFont.fontPtr + index + 1, size);
-            x += size;
+            markDirty(x, y + bank, (width > COLS) ? COLS : width);
         }
     }
 }
 
-void drawLogo()
+/**
+ * Draws the given characters centred on the display
+ */
+void drawCentredText(uint8_t y, uint8_t offset, const char str[], int textSize,
+                     TextFont fontType)
 {
-    uint8_t offset = 4;
-    uint32_t time = 200;
-    uint8_t y = 2;
-
-    drawText(33, y, offset, "AM", 2, CURSIVE);
-    wait_1s(2);
-    clearDisplay();
-
-    drawText(31, y, offset, "AlMa", 4, CURSIVE);
-    wait_1ms(time);
-    clearDisplay();
+    drawText((COLS - measureText(str, textSize, fontType)) / 2, y, offset, str,
+             textSize, fontType);
+}
 
-    drawText(29, y, offset, "All Ma", 6, CURSIVE);
-    wait_1ms(time);
-    clearDisplay();
+/**
+ * Characters of logoName revealed at each step of the logo, starting with the initials
+ */
+const char logoName[LOGO_NAME_SIZE + 1] = "Allison  Marias";
+const uint32_t logoSteps[LOGO_STEPS] =
+{
+    (1UL << 0) | (1UL << 9),            // AM
+    (1UL << 1) | (1UL << 10),           // AlMa
+    (1UL << 2) | (1UL << 7),            // All Ma
+    (1UL << 3) | (1UL << 11),           // Alli Mar
+    (1UL << 4) | (1UL << 12),           // Allis Mari
+    (1UL << 5) | (1UL << 13),           // Alliso Maria
+    (1UL << 6) | (1UL << 8) | (1UL << 14) // Allison  Marias
+};
 
-    drawText(27, y, offset, "Alli Mar", 8, CURSIVE);
-    wait_1ms(time);
-    clearDisplay();
+void drawLogo()
+{
+    TextReveal reveal;
+    uint8_t i;
 
-    drawText(23, y, offset, "Allis Mari", 10, CURSIVE);
-    wait_1ms(time);
-    clearDisplay();
+    startTextReveal(&reveal, COLS / 2, 2, 4, logoName, LOGO_NAME_SIZE,
+                    CURSIVE, ALIGN_CENTRE);
 
-    drawText(19, y, offset, "Alliso Maria", 12, CURSIVE);
-    wait_1ms(time);
-    clearDisplay();
+    revealText(&reveal, logoSteps[0]);
+    updateDisplay();
+    wait_1s(2);
 
-    drawText(11, y, offset, "Allison  Marias", 15, CURSIVE);
+    for (i = 1; i < LOGO_STEPS; i++)
+    {
+        revealText(&reveal, logoSteps[i]);
+        updateDisplay();
+        if (i < LOGO_STEPS - 1)
+        {
+            wait_1ms(200);
+        }
+    }
 }
 
 // Not finished
@@ -368,23 +453,50 @@ void menu()
 
 }
 
+/**
+ * Characters the font does not define map to its fallback glyph
+ */
+const Glyph *getGlyph(const Font *font, char c)
+{
+    uint8_t index = (uint8_t) (c - font->firstChar);
+    return &font->glyphPtr[(index < font->numOfChars) ? index + 1 : 0];
+}
+
+/**
+ * Points each font at its columns, which are read in place from the asset bundle
+ * A font missing from the bundle has no characters, and every character is blank
+ */
+void loadFonts()
+{
+    const uint8_t *columns;
+    uint8_t i;
+    for (i = 0; i < numOfFonts; i++)
+    {
+        columns = getAssetData(findAsset(fontAssets[i]));
+        if (columns)
+        {
+            fonts[i]->fontPtr = columns;
+        }
+        else
+        {
+            fonts[i]->fontPtr = &blankColumn;
+            fonts[i]->glyphPtr = &blankGlyph;
+            fonts[i]->numOfChars = 0;
+        }
+    }
+}
+
 void setFont(TextFont fontType)
 {
-    switch (fontType)
+    if (fontType >= numOfFonts)
     {
-    case CURSIVE:
-        currentFont.fontPtr = cursiveChars;
-        break;
-    case BOLD:
-        currentFont.fontPtr = boldChars;
-        break;
-    default:
-        currentFont.fontPtr = regularChars;
-        break;
+        fontType = REGULAR;
     }
-    currentFont.fontType = fontType;
+    currentFont = *fonts[fontType];
 }
 
+#ifdef PART_TM4C123GH6PM
+
 /*
  * Initialization and Configuration of SSI Module 0 (see page 965 of the data sheet)
  */
@@ -412,8 +524,17 @@ void initSSI()
     SSI0_CR1_R |= SSE; // Enable the SSI by setting the SSE bit
 }
 
+#else
+
+void initSSI()
+{
+}
+
+#endif
+
 void initLCD()
 {
+    loadFonts();
     initSSI();
     setFont(CURSIVE); // Assuming we start the program with the logo
     reset();
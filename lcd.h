@@ -3,6 +3,12 @@
 
 #include <stdint.h>
 
+enum
+{
+    COLS = 84, ROWS = 48, BANKS = ROWS / 8
+};
+// LCD Screen Size
+
 /**
  * ==================================================================
  * Instructions for the LCD (see PCD8544 Data Sheet)
@@ -38,33 +44,78 @@ typedef enum
 
 typedef enum
 {
-    REGULAR, CURSIVE, BOLD, numOfFonts
+    REGULAR, CURSIVE, BOLD, LARGE, GIANT, numOfFonts
 } TextFont;
 
+typedef struct Glyphs {
+    uint16_t offset; // Index of the first column in fontPtr
+    uint8_t width; // Number of columns
+} Glyph;
+
 typedef struct Fonts {
     TextFont fontType;
     const uint8_t *fontPtr;
-    const uint8_t *textMapPtr;
+    const Glyph *glyphPtr; // Fallback glyph first, then one glyph per character from firstChar
+    char firstChar;
+    uint8_t numOfChars;
+    uint8_t height; // Line height in pixels; taller glyphs are stored a bank at a time
 } Font;
 
+extern Font *const fonts[numOfFonts];
+
+/**
+ * ==================================================================
+ * Frame Buffer
+ * ==================================================================
+ */
+
+extern uint8_t frameBuffer[BANKS][COLS];
+extern uint8_t dirtyStart[BANKS], dirtyEnd[BANKS]; // Columns [start, end) to send
+extern uint32_t bytesTransmitted;
+
+/**
+ * ==================================================================
+ * Logo
+ * ==================================================================
+ */
+
+enum
+{
+    LOGO_STEPS = 7, LOGO_NAME_SIZE = 15
+};
+
+extern const char logoName[LOGO_NAME_SIZE + 1];
+extern const uint32_t logoSteps[LOGO_STEPS];
+
 
 /* ================================================================== */
 
 void reset();
 
 void transmitData(InstructionMode mode, uint8_t data);
+void transmitDataBuffer(const uint8_t data[], int size);
 void transmitBasicInstruction(BasicInstruction instruction);
 void transmitExtendedInstruction(ExtendedInstruction instruction);
 
 void setAddress(uint8_t x, uint8_t y);
 
+void markDirty(uint8_t x, uint8_t y, uint8_t width);
+void updateDisplay();
 void clearDisplay();
 void drawShape(uint8_t x, uint8_t y, uint8_t offset, const uint8_t shape[], int arraySize);
+void drawBankedShape(uint8_t x, uint8_t y, uint8_t offset, const uint8_t shape[], int width, uint8_t banks);
+void rasterShape(uint8_t dest[], uint8_t stride, uint8_t destBanks, int x, uint8_t y, uint8_t offset,
+                 const uint8_t shape[], int width, uint8_t banks);
+int rasterText(uint8_t dest[], uint8_t stride, uint8_t destBanks, uint8_t x, uint8_t y, uint8_t offset,
+               const char text[], int textSize, TextFont fontType);
 void drawPixel(uint8_t x, uint8_t y, uint8_t offset);
-void drawText(uint8_t x, uint8_t y, uint8_t offset, char text[], int textSize, TextFont fontType);
+void drawText(uint8_t x, uint8_t y, uint8_t offset, const char text[], int textSize, TextFont fontType);
+void drawCentredText(uint8_t y, uint8_t offset, const char text[], int textSize, TextFont fontType);
 void drawLogo();
 void menu();
 
+const Glyph *getGlyph(const Font *font, char c);
+void loadFonts();
 void setFont(TextFont fontType);
 void initSSI();
 void initLCD();
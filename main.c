@@ -4,38 +4,156 @@
  *
  * At 3.3V the back light draws 80 mA. For a dimmer back light, the 3.3V can be connected to a 100 ohm resistor,
  * and the other end of the resistor to the LED/BL pin.
+ *
+ * Built without PART_TM4C123GH6PM, on a host (gcc -std=c99 -I. with every .c file but
+ * tm4c123gh6pm_startup_ccs.c), the program plays replay.bin through the same frame loop
+ * and prints the display it ends on.
  */
 
+#ifdef PART_TM4C123GH6PM
 #include "tm4c123gh6pm.h"
+#else
+#include <stdio.h>
+#endif
 #include "timer.h"
 #include "lcd.h"
+#include "benchmark.h"
+#include "input.h"
+#include "joystick.h"
+#include "replay.h"
+#include "tilemap.h"
+#include "latency.h"
 
-#define PORT_F (1 << 5) // LED
+#define PORT_F (1 << 5) // LED, SW1 and SW2
 #define LED_GREEN (1 << 3)
+#define PRESS_MARK_WIDTH (4)
+
+#ifdef PART_TM4C123GH6PM
 
 /**
  * Turns the launchpad LED green
  */
 void greenLED(){
+    SYSCTL_RCGCGPIO_R |= PORT_F;
     GPIO_PORTF_DIR_R |= LED_GREEN; // Output
     GPIO_PORTF_DEN_R |= LED_GREEN; // Enable digital functions
     GPIO_PORTF_DATA_R |= LED_GREEN;
 }
 
+void toggleLED(){
+    GPIO_PORTF_DATA_R ^= LED_GREEN;
+}
+
+#else
+
+void greenLED(){
+}
+
+void toggleLED(){
+}
+
+#endif
+
 void setup(){
-    SYSCTL_RCGCGPIO_R |= PORT_F;
     initTimer();
+    initClock();
     greenLED();
+    initInput();
+    initJoystick();
     initLCD();
+    loadLevels();
+}
+
+/**
+ * Inverts a small block in the top corner for the button, SW1 left and SW2 right
+ */
+void markPress(Button button){
+    uint8_t i, x = (button == BUTTON_SW1) ? 0 : COLS - PRESS_MARK_WIDTH;
+    for (i = 0; i < PRESS_MARK_WIDTH; i++)
+    {
+        frameBuffer[0][x + i] ^= 0xFF;
+    }
+    markDirty(x, 0, PRESS_MARK_WIDTH);
+}
+
+/**
+ * One fixed step of the game: takes the frame's input and updates the display
+ * Each press is shown by the display update at the end of its frame
+ */
+void runFrame(){
+    InputEvent event;
+
+    waitForFrame();
+    replayFrame();
+    while (getInputEvent(&event))
+    {
+        if (event.type == BUTTON_PRESS)
+        {
+            toggleLED(); // Until the menu takes input
+            markPress((Button) event.button);
+            trackLatency(&event);
+        }
+        else if ((event.type == BUTTON_HOLD) && (event.button == BUTTON_SW2))
+        {
+            stopRecording(); // Saves the log for a REPLAY build
+        }
+    }
+    updateDisplay();
 }
 
+#ifdef PART_TM4C123GH6PM
+
 int main(void)
 {
     setup();
 
+#ifdef BENCHMARK
+    runBenchmarks();
+#endif
+
     wait_1s(2);
     menu();
+
+#ifdef REPLAY
+    startReplay(getFlashReplay());
+#else
+    startRecording(getTime());
+#endif
+
     while(1){
+        runFrame();
     }
 	return 0;
 }
+
+#else
+
+int main(void)
+{
+    uint8_t x, y;
+
+    setup();
+    startReplay(getFlashReplay());
+    if (replayMode != REPLAY_PLAYING)
+    {
+        printf("No replay in replay.bin\n");
+        return 1;
+    }
+    while (replayMode == REPLAY_PLAYING)
+    {
+        runFrame();
+    }
+
+    printf("%u frames\n", (unsigned) replayFrameCount);
+    for (y = 0; y < ROWS; y++)
+    {
+        for (x = 0; x < COLS; x++)
+        {
+            putchar((frameBuffer[y >> 3][x] & (1 << (y & 7))) ? '#' : '.');
+        }
+        putchar('\n');
+    }
+    return 0;
+}
+
+#endif
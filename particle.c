@@ -0,0 +1,153 @@
+/**
+ * ==================================================================
+ * Particles
+ * ==================================================================
+ *
+ * Particles are stored as one Q8.8 array per component, with the live
+ * ones packed at the front: a particle that dies is replaced by the last
+ * one, so every pass is a plain loop over numOfParticles.
+ *
+ * updateParticles() moves them all in one batch, a component at a time.
+ * drawParticles() puts back the pixels it covered last frame, plots every
+ * live particle in one pass, and marks a single box dirty: the union of
+ * the old and new pixels.
+ *
+ * Each plotted pixel remembers what was under it, so particles can fly
+ * over anything already in the frame buffer. Anything drawn under a
+ * particle between two calls is overwritten when the particle moves on,
+ * so draw particles after everything else in the frame.
+ *
+ * ==================================================================
+ * ==================================================================
+ */
+
+#include "particle.h"
+#include "lcd.h"
+#include "draw.h"
+#include "random.h"
+
+Fixed8 particleX[MAX_PARTICLES], particleY[MAX_PARTICLES];
+Fixed8 particleVX[MAX_PARTICLES], particleVY[MAX_PARTICLES];
+uint8_t particleLife[MAX_PARTICLES];
+uint8_t numOfParticles;
+
+uint8_t plottedX[MAX_PARTICLES], plottedY[MAX_PARTICLES]; // Pixels drawn last frame
+uint8_t plottedUnder[MAX_PARTICLES]; // Whether each pixel was set before it was drawn
+uint8_t numOfPlotted;
+
+/**
+ * Sends particles out from the point in random directions
+ * Particles that do not fit in the pool are dropped, as are particles with no life
+ */
+void emitParticles(int16_t x, int16_t y, uint8_t count, Fixed8 speed, uint8_t life)
+{
+    Angle angle;
+    uint8_t i;
+
+    if (life == 0)
+    {
+        return;
+    }
+    for (; (count > 0) && (numOfParticles < MAX_PARTICLES); count--)
+    {
+        i = numOfParticles++;
+        angle = (Angle) nextRandom();
+        particleX[i] = INT_TO_FIXED8(x);
+        particleY[i] = INT_TO_FIXED8(y);
+        particleVX[i] = fixed8Mul(FIXED_TO_FIXED8(fixedCos(angle)), speed);
+        particleVY[i] = fixed8Mul(FIXED_TO_FIXED8(fixedSin(angle)), speed);
+        particleLife[i] = life;
+    }
+}
+
+/**
+ * Moves every particle one frame and removes the ones that died or left the display
+ */
+void updateParticles()
+{
+    uint8_t i, last;
+
+    for (i = 0; i < numOfParticles; i++)
+    {
+        particleVY[i] += PARTICLE_GRAVITY;
+    }
+    for (i = 0; i < numOfParticles; i++)
+    {
+        particleX[i] = fixed8Add(particleX[i], particleVX[i]);
+        particleY[i] = fixed8Add(particleY[i], particleVY[i]);
+    }
+    for (i = 0; i < numOfParticles;)
+    {
+        if ((--particleLife[i] == 0) || ((uint16_t) FIXED8_TO_INT(particleX[i]) >= COLS)
+                || ((uint16_t) FIXED8_TO_INT(particleY[i]) >= ROWS))
+        {
+            last = --numOfParticles;
+            particleX[i] = particleX[last];
+            particleY[i] = particleY[last];
+            particleVX[i] = particleVX[last];
+            particleVY[i] = particleVY[last];
+            particleLife[i] = particleLife[last];
+        }
+        else
+        {
+            i++;
+        }
+    }
+}
+
+/**
+ * Particles off the display are not drawn
+ */
+void drawParticles()
+{
+    uint8_t i, x, y, bank;
+    uint8_t left = COLS, right = 0, top = ROWS, bottom = 0;
+    int16_t particleColumn, particleRow;
+
+    for (i = numOfPlotted; i-- > 0;)
+    { // Last drawn first, so overlapping particles restore what was first under them
+        x = plottedX[i];
+        y = plottedY[i];
+        if (plottedUnder[i])
+        {
+            SET_PIXEL(x, y);
+        }
+        else
+        {
+            CLEAR_PIXEL(x, y);
+        }
+        left = (x < left) ? x : left;
+        right = (x > right) ? x : right;
+        top = (y < top) ? y : top;
+        bottom = (y > bottom) ? y : bottom;
+    }
+    numOfPlotted = 0;
+    for (i = 0; i < numOfParticles; i++)
+    {
+        particleColumn = FIXED8_TO_INT(particleX[i]);
+        particleRow = FIXED8_TO_INT(particleY[i]);
+        if (!ON_DISPLAY(particleColumn, particleRow))
+        {
+            continue;
+        }
+        x = particleColumn;
+        y = particleRow;
+        plottedX[numOfPlotted] = x;
+        plottedY[numOfPlotted] = y;
+        plottedUnder[numOfPlotted] = TEST_PIXEL(x, y);
+        numOfPlotted++;
+        SET_PIXEL(x, y);
+        left = (x < left) ? x : left;
+        right = (x > right) ? x : right;
+        top = (y < top) ? y : top;
+        bottom = (y > bottom) ? y : bottom;
+    }
+
+    if (left <= right)
+    {
+        for (bank = top >> 3; bank <= (bottom >> 3); bank++)
+        {
+            markDirty(left, bank, right - left + 1);
+        }
+    }
+}
@@ -0,0 +1,34 @@
+#ifndef PARTICLE_H
+#define PARTICLE_H
+
+#include <stdint.h>
+#include "fixed.h"
+
+/**
+ * ==================================================================
+ * Particles
+ * ==================================================================
+ */
+
+enum
+{
+    MAX_PARTICLES = 64
+};
+
+#define PARTICLE_GRAVITY FIXED8(0.0625) // Pixels per frame per frame
+
+/**
+ * Live particles are kept at the start of each array
+ */
+extern Fixed8 particleX[MAX_PARTICLES], particleY[MAX_PARTICLES]; // Pixels
+extern Fixed8 particleVX[MAX_PARTICLES], particleVY[MAX_PARTICLES]; // Pixels per frame
+extern uint8_t particleLife[MAX_PARTICLES]; // Frames left
+extern uint8_t numOfParticles;
+
+/* ================================================================== */
+
+void emitParticles(int16_t x, int16_t y, uint8_t count, Fixed8 speed, uint8_t life);
+void updateParticles();
+void drawParticles();
+
+#endif // PARTICLE_H
@@ -0,0 +1,41 @@
+/**
+ * ==================================================================
+ * Random Numbers
+ * ==================================================================
+ *
+ * xorshift32: the same seed gives the same sequence on any target,
+ * which is what lets a recorded game be replayed.
+ *
+ * ==================================================================
+ * ==================================================================
+ */
+
+#include "random.h"
+
+uint32_t randomSeed = 1;
+uint32_t randomState = 1;
+
+void seedRandom(uint32_t seed)
+{
+    randomSeed = (seed != 0) ? seed : 1; // xorshift never leaves 0
+    randomState = randomSeed;
+}
+
+uint32_t getRandomSeed()
+{
+    return randomSeed;
+}
+
+uint32_t nextRandom()
+{
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+    return randomState;
+}
+
+// Returns a number from 0 to range - 1
+uint32_t randomRange(uint32_t range)
+{
+    return (uint32_t) (((uint64_t) nextRandom() * range) >> 32);
+}
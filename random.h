@@ -0,0 +1,11 @@
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include <stdint.h>
+
+void seedRandom(uint32_t seed);
+uint32_t getRandomSeed();
+uint32_t nextRandom();
+uint32_t randomRange(uint32_t range);
+
+#endif // RANDOM_H
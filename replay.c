@@ -0,0 +1,287 @@
+/**
+ * ==================================================================
+ * Input Recording and Replay
+ * ==================================================================
+ *
+ * Call replayFrame() at the start of every frame, after waitForFrame() and
+ * before draining input. A frame is a fixed FRAME_MS step, so the same log
+ * plays back on the same frames however fast the loop itself runs.
+ *
+ * Recording: events are logged with the frame they were taken off the
+ * input queue, together with the random seed.
+ *
+ * Replay: live input is ignored and each logged event is put back on the
+ * input queue at the start of the same frame, so the game sees exactly the
+ * same input on the same frames.
+ *
+ * The log lives in RAM. When recording stops, or the log fills up, it is
+ * saved to the last 2 KB of flash (see tm4c123gh6pm.cmd) and replayed from
+ * there in place; it can also be sent over UART0 (the debug USB serial
+ * port). Host builds use a file instead.
+ *
+ * ==================================================================
+ * ==================================================================
+ */
+
+#include "replay.h"
+#include "input.h"
+#include "random.h"
+#include "timer.h"
+
+#ifdef PART_TM4C123GH6PM
+#include "tm4c123gh6pm.h"
+#else
+#include <stdio.h>
+#endif
+
+ReplayLog replayLog;
+ReplayMode replayMode;
+uint32_t replayFrameCount;
+uint32_t replayEventsLost;
+
+const ReplayLog *replaying;
+uint16_t replayPosition;
+uint32_t lastRecordFrame; // Frame of the previous record
+
+void startRecording(uint32_t seed)
+{
+    seedRandom(seed);
+    replayLog.seed = getRandomSeed();
+    replayLog.size = 0;
+    replayFrameCount = 0;
+    lastRecordFrame = 0;
+    replayEventsLost = 0;
+    setInputReplaying(0);
+    replayMode = REPLAY_RECORDING;
+}
+
+/**
+ * Ends the recording and saves the log
+ */
+void stopRecording()
+{
+    if (replayMode == REPLAY_RECORDING)
+    {
+        replayMode = REPLAY_OFF;
+        saveReplayToFlash();
+    }
+}
+
+/**
+ * Plays the log back from the next frame; the log is read in place
+ */
+void startReplay(const ReplayLog *log)
+{
+    if (log == 0)
+    {
+        return;
+    }
+    replaying = log;
+    replayPosition = 0;
+    replayFrameCount = 0;
+    lastRecordFrame = 0;
+    seedRandom(log->seed);
+    setInputReplaying(1);
+    replayMode = REPLAY_PLAYING;
+}
+
+void stopReplay()
+{
+    setInputReplaying(0);
+    replayMode = REPLAY_OFF;
+}
+
+/**
+ * Adds a record; when the log is full, recording stops and the log is saved
+ */
+void appendRecord(uint8_t frames, uint8_t event)
+{
+    if (replayLog.size + 2 > REPLAY_LOG_SIZE)
+    {
+        stopRecording();
+        replayMode = REPLAY_FULL;
+        return;
+    }
+    replayLog.records[replayLog.size++] = frames;
+    replayLog.records[replayLog.size++] = event;
+}
+
+/**
+ * Called by getInputEvent for every event the game takes
+ */
+void recordInputEvent(const InputEvent *event)
+{
+    while ((replayMode == REPLAY_RECORDING)
+            && (replayFrameCount - lastRecordFrame > 0xFF))
+    {
+        appendRecord(0xFF, REPLAY_WAIT << 4);
+        lastRecordFrame += 0xFF;
+    }
+    if (replayMode == REPLAY_RECORDING)
+    {
+        appendRecord(replayFrameCount - lastRecordFrame, (event->type << 4) | event->button);
+        lastRecordFrame = replayFrameCount;
+    }
+    if (replayMode == REPLAY_FULL)
+    {
+        replayEventsLost++;
+    }
+}
+
+void replayFrame()
+{
+    uint8_t frames, event;
+
+    replayFrameCount++;
+    if (replayMode != REPLAY_PLAYING)
+    {
+        return;
+    }
+
+    while (replayPosition + 2 <= replaying->size)
+    {
+        frames = replaying->records[replayPosition];
+        event = replaying->records[replayPosition + 1];
+        if (lastRecordFrame + frames != replayFrameCount)
+        {
+            return;
+        }
+        replayPosition += 2;
+        lastRecordFrame += frames;
+        if ((event >> 4) != REPLAY_WAIT)
+        {
+            pushInputEvent((InputEventType) (event >> 4), (Button) (event & 0xF), getTime());
+        }
+    }
+    stopReplay(); // Events already queued are still delivered
+}
+
+#ifdef PART_TM4C123GH6PM
+
+#define REPLAY_FLASH ((const ReplayLog *) 0x0003F800)
+#define FLASH_PAGE_SIZE (1024)
+#define FLASH_ALTERNATE_KEY (0x71D50000) // Write key when BOOTCFG KEY is clear
+
+#define PORT_A (1 << 0)
+#define UART_0 (1 << 0)
+#define UART_PINS ((1 << 0) | (1 << 1)) // PA0: U0Rx, PA1: U0Tx
+
+/**
+ * Erases the replay area of flash and copies the log into it
+ * Interrupts keep running; the erase and each word write stall the CPU briefly
+ */
+void saveReplayToFlash()
+{
+    const uint32_t *words = (const uint32_t *) &replayLog;
+    uint32_t address = (uint32_t) REPLAY_FLASH;
+    uint32_t key = (FLASH_BOOTCFG_R & FLASH_BOOTCFG_KEY) ? FLASH_FMC_WRKEY : FLASH_ALTERNATE_KEY;
+    uint32_t i;
+
+    for (i = 0; i < sizeof(ReplayLog); i += FLASH_PAGE_SIZE)
+    {
+        FLASH_FMA_R = address + i;
+        FLASH_FMC_R = key | FLASH_FMC_ERASE;
+        while (FLASH_FMC_R & FLASH_FMC_ERASE)
+        {
+        }
+    }
+    for (i = 0; i < sizeof(ReplayLog) / 4; i++)
+    {
+        FLASH_FMA_R = address + 4 * i;
+        FLASH_FMD_R = words[i];
+        FLASH_FMC_R = key | FLASH_FMC_WRITE;
+        while (FLASH_FMC_R & FLASH_FMC_WRITE)
+        {
+        }
+    }
+}
+
+/**
+ * Returns the log saved in flash, or 0 if none has been saved (erased flash)
+ */
+const ReplayLog *getFlashReplay()
+{
+    return (REPLAY_FLASH->size <= REPLAY_LOG_SIZE) ? REPLAY_FLASH : 0;
+}
+
+/**
+ * 115200 baud, 8 data bits, no parity, 1 stop bit
+ * BRD = 16 MHz / (16 * 115200) = 8.6806: IBRD = 8, FBRD = 0.6806 * 64 = 44
+ */
+void initUART()
+{
+    SYSCTL_RCGCUART_R |= UART_0;
+    SYSCTL_RCGCGPIO_R |= PORT_A;
+    while ((SYSCTL_PRUART_R & UART_0) == 0)
+    {
+    }
+    UART0_CTL_R &= ~UART_CTL_UARTEN;
+    UART0_IBRD_R = 8;
+    UART0_FBRD_R = 44;
+    UART0_LCRH_R = UART_LCRH_WLEN_8 | UART_LCRH_FEN;
+    UART0_CC_R = 0x0; // System clock
+    UART0_CTL_R |= UART_CTL_UARTEN | UART_CTL_TXE;
+
+    GPIO_PORTA_AFSEL_R |= UART_PINS;
+    GPIO_PORTA_PCTL_R = (GPIO_PORTA_PCTL_R & ~0xFF) | 0x11;
+    GPIO_PORTA_DEN_R |= UART_PINS;
+}
+
+/**
+ * Sends the header and records as raw bytes over UART0
+ */
+void sendReplay(const ReplayLog *log)
+{
+    const uint8_t *bytes = (const uint8_t *) log;
+    int i, size = (sizeof(ReplayLog) - REPLAY_LOG_SIZE) + log->size;
+
+    initUART();
+    for (i = 0; i < size; i++)
+    {
+        while (UART0_FR_R & UART_FR_TXFF)
+        {
+        }
+        UART0_DR_R = bytes[i];
+    }
+}
+
+#else
+
+#define REPLAY_FILE "replay.bin"
+
+ReplayLog fileReplay;
+
+void saveReplayToFlash()
+{
+    FILE *file = fopen(REPLAY_FILE, "wb");
+    if (file)
+    {
+        fwrite(&replayLog, sizeof(ReplayLog), 1, file);
+        fclose(file);
+    }
+}
+
+/**
+ * Reads a log saved by saveReplayToFlash() or captured from sendReplay()
+ */
+const ReplayLog *getFlashReplay()
+{
+    FILE *file = fopen(REPLAY_FILE, "rb");
+    size_t header = sizeof(ReplayLog) - REPLAY_LOG_SIZE, count;
+    int found = 0;
+    if (file)
+    {
+        count = fread(&fileReplay, 1, sizeof(ReplayLog), file);
+        found = (count >= header) && (fileReplay.size <= REPLAY_LOG_SIZE)
+                && (count >= header + fileReplay.size);
+        fclose(file);
+    }
+    return found ? &fileReplay : 0;
+}
+
+void sendReplay(const ReplayLog *log)
+{
+    fwrite(log, (sizeof(ReplayLog) - REPLAY_LOG_SIZE) + log->size, 1, stdout);
+}
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include <stdint.h>
+#include "input.h"
+
+/**
+ * ==================================================================
+ * Input Recording and Replay
+ * ==================================================================
+ *
+ * Each input event is stored as two bytes:
+ * the number of frames since the previous record, then (type << 4) | button.
+ * A REPLAY_WAIT record carries no event and only advances the frame count.
+ * Frames are FRAME_MS apart, so a full log covers at least 85 minutes.
+ */
+
+enum
+{
+    REPLAY_LOG_SIZE = 2040, // Bytes of records; the whole log fills two 1 KB flash pages
+    REPLAY_WAIT = 0xF
+};
+
+typedef enum
+{
+    REPLAY_OFF, REPLAY_RECORDING, REPLAY_PLAYING,
+    REPLAY_FULL // Recording stopped and was saved because the log filled up
+} ReplayMode;
+
+typedef struct ReplayLogs {
+    uint32_t seed; // Random seed at the start of the game
+    uint16_t size; // Bytes of records
+    uint16_t reserved;
+    uint8_t records[REPLAY_LOG_SIZE];
+} ReplayLog;
+
+extern ReplayLog replayLog;
+extern ReplayMode replayMode;
+extern uint32_t replayFrameCount;
+extern uint32_t replayEventsLost; // Events taken after the log filled up
+
+/* ================================================================== */
+
+void startRecording(uint32_t seed);
+void stopRecording();
+void startReplay(const ReplayLog *log);
+void stopReplay();
+void replayFrame();
+void recordInputEvent(const InputEvent *event);
+
+void saveReplayToFlash();
+const ReplayLog *getFlashReplay();
+void sendReplay(const ReplayLog *log);
+
+#endif // REPLAY_H
@@ -0,0 +1,132 @@
+/**
+ * ==================================================================
+ * Horizontal Scrolling
+ * ==================================================================
+ *
+ * Scrolling a level by a few pixels would otherwise mean redrawing all
+ * 84 columns. Instead the level is kept in a ring of columns wider than
+ * the display: scrolling by n pixels draws only the n columns at the
+ * far edge of the margin, over the n columns that left the other edge,
+ * so the columns coming into view are already there.
+ *
+ * Vertically the view can start at any pixel row. Each bank of a column
+ * is then the bottom of one tile row and the top of the next. A vertical
+ * move changes every column, so the whole ring is drawn again.
+ *
+ * The ring is not sent to the display itself. composeLayers() reads the
+ * view out of it a word at a time with getScrollWord() and merges it
+ * over the parallax layers, so sprites and anything else in the frame
+ * buffer are drawn over the level and only reach the display through
+ * updateDisplay().
+ *
+ * ==================================================================
+ * ==================================================================
+ */
+
+#include "scroll.h"
+#include "layers.h"
+
+uint8_t scrollRing[BANKS][SCROLL_RING_COLS];
+int16_t scrollX;
+int16_t scrollY;
+uint16_t scrollColumnsDrawn; // Columns drawn into the ring
+
+const Level *scrollLevel;
+int16_t scrollRow; // Tile row at the top of the display
+uint8_t scrollShift; // Pixels of scrollRow above the display
+
+/**
+ * Draws the level column at x into its ring column
+ */
+void drawScrollColumn(int16_t x)
+{
+    int16_t column = (x < 0) ? -((TILE_SIZE - 1 - x) / TILE_SIZE) : x / TILE_SIZE;
+    uint8_t pixel = x - column * TILE_SIZE;
+    uint8_t i = (uint8_t) (x & (SCROLL_RING_COLS - 1));
+    uint8_t bank, upper, lower;
+
+    upper = scrollLevel->tileset[getTile(scrollLevel, column, scrollRow) * TILE_SIZE + pixel];
+    for (bank = 0; bank < BANKS; bank++)
+    {
+        lower = (scrollShift || (bank + 1 < BANKS))
+                ? scrollLevel->tileset[getTile(scrollLevel, column, scrollRow + bank + 1)
+                        * TILE_SIZE + pixel] : 0;
+        scrollRing[bank][i] = (upper >> scrollShift) | (uint8_t) (lower << (8 - scrollShift));
+        upper = lower;
+    }
+    scrollColumnsDrawn++;
+}
+
+/**
+ * Marks the whole view to be merged again
+ */
+void invalidateScroll()
+{
+    uint8_t bank;
+    for (bank = 0; bank < BANKS; bank++)
+    {
+        invalidateLayers(0, bank, COLS);
+    }
+}
+
+/**
+ * Fills the ring with the level around pixel x, from pixel row y
+ */
+void startScroll(const Level *level, int16_t x, int16_t y)
+{
+    uint8_t i;
+    scrollLevel = level;
+    scrollRow = (y < 0) ? -((TILE_SIZE - 1 - y) / TILE_SIZE) : y / TILE_SIZE;
+    scrollShift = y - scrollRow * TILE_SIZE;
+    scrollX = x;
+    scrollY = y;
+    for (i = 0; i < SCROLL_RING_COLS; i++)
+    {
+        drawScrollColumn(x - SCROLL_MARGIN + i);
+    }
+    invalidateScroll();
+}
+
+/**
+ * Moves the top left corner of the view to level pixel (x, y)
+ */
+void scrollTo(int16_t x, int16_t y)
+{
+    int16_t distance = x - scrollX;
+
+    if ((distance == 0) && (y == scrollY))
+    {
+        return;
+    }
+    if ((y != scrollY) || (distance >= SCROLL_RING_COLS) || (distance <= -SCROLL_RING_COLS))
+    {
+        startScroll(scrollLevel, x, y);
+        return;
+    }
+    for (; distance > 0; distance--) // Columns come in on the right
+    {
+        scrollX++;
+        drawScrollColumn(scrollX + COLS + SCROLL_MARGIN - 1);
+    }
+    for (; distance < 0; distance++) // Columns come in on the left
+    {
+        scrollX--;
+        drawScrollColumn(scrollX - SCROLL_MARGIN);
+    }
+    invalidateScroll();
+}
+
+/**
+ * 4 columns of one bank of the view from display column x, packed like a
+ * layer word
+ */
+uint32_t getScrollWord(uint8_t bank, uint8_t x)
+{
+    const uint8_t *ring = scrollRing[bank];
+    uint8_t i = (uint8_t) ((scrollX + x) & (SCROLL_RING_COLS - 1));
+
+    return ring[i]
+            | ((uint32_t) ring[(i + 1) & (SCROLL_RING_COLS - 1)] << 8)
+            | ((uint32_t) ring[(i + 2) & (SCROLL_RING_COLS - 1)] << 16)
+            | ((uint32_t) ring[(i + 3) & (SCROLL_RING_COLS - 1)] << 24);
+}
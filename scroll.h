@@ -0,0 +1,38 @@
+#ifndef SCROLL_H
+#define SCROLL_H
+
+#include <stdint.h>
+#include "lcd.h"
+#include "tilemap.h"
+
+/**
+ * ==================================================================
+ * Horizontal Scrolling
+ * ==================================================================
+ *
+ * scrollRing holds the level from SCROLL_MARGIN columns left of the
+ * display to SCROLL_MARGIN columns right of it. Level column x is kept in
+ * ring column x & (SCROLL_RING_COLS - 1), so the ring wraps as the view
+ * moves. The ring's rows start at level pixel row scrollY, which need not
+ * be a multiple of a bank.
+ */
+
+enum
+{
+    SCROLL_RING_COLS = 128, // Power of 2 wider than the display
+    SCROLL_MARGIN = (SCROLL_RING_COLS - COLS) / 2 // Columns drawn ahead on each side
+};
+
+extern uint8_t scrollRing[BANKS][SCROLL_RING_COLS];
+extern int16_t scrollX; // Level pixel at the left edge of the display
+extern int16_t scrollY; // Level pixel row at the top of the display
+extern uint16_t scrollColumnsDrawn;
+extern const Level *scrollLevel; // 0 until startScroll()
+
+/* ================================================================== */
+
+void startScroll(const Level *level, int16_t x, int16_t y);
+void scrollTo(int16_t x, int16_t y);
+uint32_t getScrollWord(uint8_t bank, uint8_t x);
+
+#endif // SCROLL_H
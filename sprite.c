@@ -0,0 +1,352 @@
+/**
+ * ==================================================================
+ * Sprites
+ * ==================================================================
+ *
+ * Each slot holds an image, a position, a z order and flags. Sprites are
+ * composited over spriteBackground, which holds everything else on the
+ * display.
+ *
+ * Only the boxes of sprites that changed since the last renderSprites()
+ * are redrawn: the box a sprite was drawn in and the box it is now in.
+ * In those columns the background is restored and every sprite touching
+ * them is composited again in z order, then the columns are marked dirty
+ * for updateDisplay(). Columns whose background changed are passed to
+ * invalidateSprites() and redrawn the same way.
+ *
+ * ==================================================================
+ * ==================================================================
+ */
+
+#include "sprite.h"
+#include "lcd.h"
+
+Sprite sprites[MAX_SPRITES];
+uint8_t spriteBackground[BANKS][COLS];
+
+uint8_t spriteOrder[MAX_SPRITES]; // Slots in use, in ascending z
+uint8_t numOfSprites;
+
+uint8_t regionStart[BANKS] = { COLS, COLS, COLS, COLS, COLS, COLS };
+uint8_t regionEnd[BANKS];
+
+/**
+ * Copies the frame buffer into the background sprites are drawn over
+ */
+void captureSpriteBackground()
+{
+    uint8_t i, j;
+    for (i = 0; i < BANKS; i++)
+    {
+        for (j = 0; j < COLS; j++)
+        {
+            spriteBackground[i][j] = frameBuffer[i][j];
+        }
+    }
+}
+
+/**
+ * Inserts the slot into spriteOrder after any sprites with the same z
+ */
+void insertSprite(uint8_t slot)
+{
+    uint8_t i = numOfSprites++;
+    while ((i > 0) && (sprites[spriteOrder[i - 1]].z > sprites[slot].z))
+    {
+        spriteOrder[i] = spriteOrder[i - 1];
+        i--;
+    }
+    spriteOrder[i] = slot;
+}
+
+void unlinkSprite(uint8_t slot)
+{
+    uint8_t i, j = 0;
+    for (i = 0; i < numOfSprites; i++)
+    {
+        if (spriteOrder[i] != slot)
+        {
+            spriteOrder[j++] = spriteOrder[i];
+        }
+    }
+    numOfSprites = j;
+}
+
+/**
+ * Returns the slot used, or 0 if all slots are in use
+ */
+Sprite *addSprite(const SpriteImage *image, int16_t x, int16_t y, uint8_t z,
+                  uint8_t flags)
+{
+    uint8_t slot;
+    for (slot = 0; slot < MAX_SPRITES; slot++)
+    {
+        if (sprites[slot].image == 0)
+        {
+            Sprite *sprite = &sprites[slot];
+            sprite->image = image;
+            sprite->x = x;
+            sprite->y = y;
+            sprite->z = z;
+            sprite->flags = flags;
+            sprite->changed = 1;
+            sprite->drawnWidth = 0;
+            sprite->drawnHeight = 0;
+            insertSprite(slot);
+            return sprite;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Marks columns of a bank to be redrawn by renderSprites()
+ */
+void invalidateSprites(uint8_t x, uint8_t bank, uint8_t width)
+{
+    if ((x >= COLS) || (bank >= BANKS) || (width == 0))
+    {
+        return;
+    }
+    if (x < regionStart[bank])
+    {
+        regionStart[bank] = x;
+    }
+    if (x + width > regionEnd[bank])
+    {
+        regionEnd[bank] = (x + width > COLS) ? COLS : x + width;
+    }
+}
+
+/**
+ * Adds the part of the box on the display to the region to redraw
+ */
+void addRegion(int16_t x, int16_t y, uint8_t width, uint8_t height)
+{
+    int16_t left = (x < 0) ? 0 : x;
+    int16_t right = (x + width > COLS) ? COLS : x + width;
+    int16_t top = (y < 0) ? 0 : y;
+    int16_t bottom = (y + height > ROWS) ? ROWS : y + height;
+    uint8_t bank;
+
+    if ((left >= right) || (top >= bottom))
+    {
+        return;
+    }
+    for (bank = top >> 3; bank < ((bottom + 7) >> 3); bank++)
+    {
+        invalidateSprites(left, bank, right - left);
+    }
+}
+
+void removeSprite(Sprite *sprite)
+{
+    addRegion(sprite->drawnX, sprite->drawnY, sprite->drawnWidth,
+              sprite->drawnHeight);
+    unlinkSprite(sprite - sprites);
+    sprite->image = 0;
+}
+
+void moveSprite(Sprite *sprite, int16_t x, int16_t y)
+{
+    if ((sprite->x != x) || (sprite->y != y))
+    {
+        sprite->x = x;
+        sprite->y = y;
+        sprite->changed = 1;
+    }
+}
+
+void setSpriteImage(Sprite *sprite, const SpriteImage *image)
+{
+    if (sprite->image != image)
+    {
+        sprite->image = image;
+        sprite->changed = 1;
+    }
+}
+
+void setSpriteFlags(Sprite *sprite, uint8_t flags)
+{
+    if (sprite->flags != flags)
+    {
+        sprite->flags = flags;
+        sprite->changed = 1;
+    }
+}
+
+void setSpriteZ(Sprite *sprite, uint8_t z)
+{
+    if (sprite->z != z)
+    {
+        uint8_t slot = sprite - sprites;
+        unlinkSprite(slot);
+        sprite->z = z;
+        insertSprite(slot);
+        sprite->changed = 1;
+    }
+}
+
+/**
+ * Returns 8 rows of a column of the image, starting at the given row
+ * Rows outside the image are 0
+ */
+uint8_t getImageBits(const SpriteImage *image, uint8_t column, int16_t row)
+{
+    uint8_t bank, shift, banks = (image->height + 7) >> 3;
+    const uint8_t *data = image->data + column;
+    uint8_t bits;
+
+    if ((row <= -8) || (row >= banks * 8))
+    {
+        return 0;
+    }
+    if (row < 0)
+    {
+        return (uint8_t) (data[0] << -row);
+    }
+    bank = row >> 3;
+    shift = row & 7;
+    bits = data[bank * image->width] >> shift;
+    if (shift && (bank + 1 < banks))
+    {
+        bits |= (uint8_t) (data[(bank + 1) * image->width] << (8 - shift));
+    }
+    return bits;
+}
+
+uint8_t reverseBits(uint8_t bits)
+{
+    bits = (uint8_t) ((bits >> 4) | (bits << 4));
+    bits = (uint8_t) (((bits & 0xCC) >> 2) | ((bits & 0x33) << 2));
+    return (uint8_t) (((bits & 0xAA) >> 1) | ((bits & 0x55) << 1));
+}
+
+/**
+ * Returns the rows of a sprite covered by 8 rows starting at the given row
+ */
+uint8_t getRowMask(const SpriteImage *image, int16_t row)
+{
+    int16_t top = (row < 0) ? -row : 0;
+    int16_t bottom = (image->height - row < 8) ? image->height - row : 8;
+    return (top >= bottom) ? 0 : (uint8_t) (((1 << bottom) - 1) & ~((1 << top) - 1));
+}
+
+/**
+ * Returns 8 rows of a column of the sprite as drawn, flipped as its flags say
+ * column and row are relative to the sprite's top left corner
+ */
+uint8_t getSpriteBits(const Sprite *sprite, uint8_t column, int16_t row)
+{
+    const SpriteImage *image = sprite->image;
+    uint8_t bits;
+
+    if (sprite->flags & SPRITE_FLIP_X)
+    {
+        column = image->width - 1 - column;
+    }
+    if (sprite->flags & SPRITE_FLIP_Y)
+    {
+        bits = reverseBits(getImageBits(image, column, image->height - 8 - row));
+    }
+    else
+    {
+        bits = getImageBits(image, column, row);
+    }
+    return bits & getRowMask(image, row);
+}
+
+/**
+ * Draws the columns [start, end) of one bank of the sprite into the frame buffer
+ */
+void compositeSprite(const Sprite *sprite, uint8_t bank, uint8_t start,
+                     uint8_t end)
+{
+    int16_t row = bank * 8 - sprite->y; // Sprite row at the top of the bank
+    uint8_t mask = getRowMask(sprite->image, row);
+    uint8_t bits, x;
+    uint8_t *dest = frameBuffer[bank];
+
+    if (mask == 0)
+    {
+        return;
+    }
+    if (sprite->x > start)
+    {
+        start = sprite->x;
+    }
+    if (sprite->x + sprite->image->width < end)
+    {
+        end = sprite->x + sprite->image->width;
+    }
+    for (x = start; x < end; x++)
+    {
+        bits = getSpriteBits(sprite, x - sprite->x, row);
+        if (sprite->flags & SPRITE_INVERT)
+        {
+            dest[x] = (dest[x] & ~mask) | (~bits & mask);
+        }
+        else
+        {
+            dest[x] |= bits;
+        }
+    }
+}
+
+/**
+ * Redraws the boxes of sprites that changed and marks them dirty
+ */
+void renderSprites()
+{
+    uint8_t i, bank, x;
+    Sprite *sprite;
+
+    for (i = 0; i < numOfSprites; i++)
+    {
+        sprite = &sprites[spriteOrder[i]];
+        if (sprite->changed)
+        {
+            addRegion(sprite->drawnX, sprite->drawnY, sprite->drawnWidth,
+                      sprite->drawnHeight);
+            if (sprite->flags & (SPRITE_HIDDEN | SPRITE_CULLED))
+            {
+                sprite->drawnWidth = 0;
+                sprite->drawnHeight = 0;
+            }
+            else
+            {
+                sprite->drawnX = sprite->x;
+                sprite->drawnY = sprite->y;
+                sprite->drawnWidth = sprite->image->width;
+                sprite->drawnHeight = sprite->image->height;
+                addRegion(sprite->x, sprite->y, sprite->drawnWidth,
+                          sprite->drawnHeight);
+            }
+            sprite->changed = 0;
+        }
+    }
+
+    for (bank = 0; bank < BANKS; bank++)
+    {
+        if (regionStart[bank] >= regionEnd[bank])
+        {
+            continue;
+        }
+        for (x = regionStart[bank]; x < regionEnd[bank]; x++)
+        {
+            frameBuffer[bank][x] = spriteBackground[bank][x];
+        }
+        for (i = 0; i < numOfSprites; i++)
+        {
+            sprite = &sprites[spriteOrder[i]];
+            if (sprite->drawnWidth && (sprite->x < regionEnd[bank])
+                    && (sprite->x + sprite->image->width > regionStart[bank]))
+            {
+                compositeSprite(sprite, bank, regionStart[bank], regionEnd[bank]);
+            }
+        }
+        markDirty(regionStart[bank], bank, regionEnd[bank] - regionStart[bank]);
+        regionStart[bank] = COLS;
+        regionEnd[bank] = 0;
+    }
+}
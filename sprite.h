@@ -0,0 +1,62 @@
+#ifndef SPRITE_H
+#define SPRITE_H
+
+#include <stdint.h>
+#include "lcd.h"
+
+/**
+ * ==================================================================
+ * Sprites
+ * ==================================================================
+ */
+
+enum
+{
+    MAX_SPRITES = 16
+};
+
+typedef enum
+{
+    SPRITE_FLIP_X = (1 << 0),
+    SPRITE_FLIP_Y = (1 << 1),
+    SPRITE_INVERT = (1 << 2), // Clears the image's pixels and sets the rest of its box
+    SPRITE_HIDDEN = (1 << 3),
+    SPRITE_CULLED = (1 << 4) // Set by the camera while the sprite is off the display
+} SpriteFlag;
+
+/**
+ * Stored a bank at a time like the fonts: width columns of the top 8 rows,
+ * then the next 8 rows, and so on
+ */
+typedef struct SpriteImages {
+    const uint8_t *data;
+    uint8_t width, height; // Pixels
+} SpriteImage;
+
+typedef struct Sprites {
+    const SpriteImage *image; // 0: free slot
+    int16_t x, y; // Top left corner in pixels; may be partly off the display
+    uint8_t z; // Higher z is drawn on top
+    uint8_t flags;
+    uint8_t changed;
+    int16_t drawnX, drawnY; // Box last composited into the frame buffer
+    uint8_t drawnWidth, drawnHeight; // 0: not on the display
+} Sprite;
+
+extern Sprite sprites[MAX_SPRITES];
+extern uint8_t spriteBackground[BANKS][COLS];
+
+/* ================================================================== */
+
+void captureSpriteBackground();
+Sprite *addSprite(const SpriteImage *image, int16_t x, int16_t y, uint8_t z, uint8_t flags);
+void removeSprite(Sprite *sprite);
+void moveSprite(Sprite *sprite, int16_t x, int16_t y);
+void setSpriteImage(Sprite *sprite, const SpriteImage *image);
+void setSpriteFlags(Sprite *sprite, uint8_t flags);
+void setSpriteZ(Sprite *sprite, uint8_t z);
+void invalidateSprites(uint8_t x, uint8_t bank, uint8_t width);
+void renderSprites();
+uint8_t getSpriteBits(const Sprite *sprite, uint8_t column, int16_t row);
+
+#endif // SPRITE_H
@@ -0,0 +1,526 @@
+/**
+ * ==================================================================
+ * Text Measurement and Layout
+ * ==================================================================
+ *
+ * Widths come straight from each font's glyph table, so text can be
+ * measured and positioned without drawing it first.
+ *
+ * Text Cache:
+ * Static text (menu labels, titles) is rasterised once into a bank-aligned
+ * strip. Later draws of the same string, font and offset copy the strip
+ * into the frame buffer. The least recently used strip is replaced on a miss.
+ * Each strip keeps a copy of its characters, so a hash collision can
+ * never draw the wrong text.
+ *
+ * Text Reveal:
+ * Characters of a line are shown a few at a time. Characters already on the
+ * display are moved along the frame buffer to keep the line aligned, and
+ * only the new glyphs are rasterised.
+ *
+ * ==================================================================
+ * ==================================================================
+ */
+
+#include "text.h"
+#include "lcd.h"
+
+#define FNV_OFFSET_BASIS (2166136261u)
+#define FNV_PRIME (16777619u)
+
+typedef struct TextStrips {
+    uint32_t hash; // Checked before the characters
+    char text[TEXT_CACHE_CHARS];
+    uint8_t textSize;
+    uint8_t fontType;
+    uint8_t offset;
+    uint8_t width;
+    uint8_t banks; // 0: unused entry
+    uint16_t lastUsed;
+    uint8_t strip[TEXT_STRIP_BYTES];
+} TextStrip;
+
+TextStrip textCache[TEXT_CACHE_ENTRIES];
+uint16_t textCacheClock;
+
+uint32_t textCacheHits;
+uint32_t textCacheMisses;
+
+/**
+ * Width of the given characters in pixels
+ */
+int measureText(const char str[], int textSize, TextFont fontType)
+{
+    const Font *font = fonts[fontType];
+    int i, width = 0;
+    for (i = 0; i < textSize; i++)
+    {
+        width += getGlyph(font, str[i])->width;
+    }
+    return width;
+}
+
+/**
+ * Word-wraps the characters into the box and aligns each line
+ * Lines break at spaces or '\n'; a word wider than the box is split
+ * Returns the number of characters that fit
+ */
+uint8_t layoutText(const char str[], int textSize, TextFont fontType,
+                   const TextBox *box, TextAlign align, TextLayout *layout)
+{
+    const Font *font = fonts[fontType];
+    uint8_t maxLines = box->height / font->height;
+    uint8_t width, glyphWidth, breakWidth, lineX;
+    TextAlign lineAlign;
+    int i = 0, start, end, breakAt, k;
+
+    if (maxLines > MAX_LAYOUT_LINES)
+    {
+        maxLines = MAX_LAYOUT_LINES;
+    }
+    if (textSize > MAX_LAYOUT_CHARS)
+    {
+        textSize = MAX_LAYOUT_CHARS;
+    }
+
+    layout->y = box->y;
+    layout->width = 0;
+    layout->lineHeight = font->height;
+    layout->numOfLines = 0;
+
+    while ((i < textSize) && (layout->numOfLines < maxLines))
+    {
+        start = i;
+        width = 0;
+        breakAt = -1;
+        breakWidth = 0;
+
+        while ((i < textSize) && (str[i] != '\n'))
+        {
+            glyphWidth = getGlyph(font, str[i])->width;
+            if (width + glyphWidth > box->width)
+            {
+                break;
+            }
+            if (str[i] == ' ')
+            {
+                breakAt = i;
+                breakWidth = width;
+            }
+            layout->charX[i] = width;
+            width += glyphWidth;
+            i++;
+        }
+
+        end = i;
+        if (i < textSize)
+        {
+            if ((str[i] == '\n') || (str[i] == ' '))
+            {
+                i++; // The line break or the space that overflowed is dropped
+            }
+            else if (breakAt > start)
+            { // Break after the last whole word
+                end = breakAt;
+                width = breakWidth;
+                i = breakAt + 1;
+            }
+            else if (i == start)
+            { // A single glyph wider than the box still takes a line
+                layout->charX[i] = 0;
+                width = getGlyph(font, str[i])->width;
+                end = ++i;
+            }
+        }
+
+        lineAlign = (width > box->width) ? ALIGN_LEFT : align;
+        switch (lineAlign)
+        {
+        case ALIGN_CENTRE:
+            lineX = box->x + (box->width - width) / 2;
+            break;
+        case ALIGN_RIGHT:
+            lineX = box->x + box->width - width;
+            break;
+        default:
+            lineX = box->x;
+            break;
+        }
+        for (k = start; k < end; k++)
+        {
+            layout->charX[k] += lineX;
+        }
+
+        if (width > layout->width)
+        {
+            layout->width = width;
+        }
+        layout->lineStart[layout->numOfLines] = start;
+        layout->lineEnd[layout->numOfLines] = end;
+        layout->numOfLines++;
+    }
+
+    layout->numOfChars = i;
+    layout->height = layout->numOfLines * layout->lineHeight;
+    return layout->numOfChars;
+}
+
+/**
+ * Draws characters at the positions found by layoutText
+ */
+void drawTextLayout(const char str[], TextFont fontType, const TextLayout *layout)
+{
+    uint8_t line, y;
+    for (line = 0; line < layout->numOfLines; line++)
+    {
+        if (layout->lineEnd[line] == layout->lineStart[line])
+        {
+            continue;
+        }
+        y = layout->y + line * layout->lineHeight;
+        drawText(layout->charX[layout->lineStart[line]], y >> 3, y & 7,
+                 str + layout->lineStart[line],
+                 layout->lineEnd[line] - layout->lineStart[line], fontType);
+    }
+}
+
+/**
+ * FNV-1a hash of the given characters
+ */
+uint32_t hashText(const char str[], int textSize)
+{
+    uint32_t hash = FNV_OFFSET_BASIS;
+    int i;
+    for (i = 0; i < textSize; i++)
+    {
+        hash = (hash ^ (uint8_t) str[i]) * FNV_PRIME;
+    }
+    return hash;
+}
+
+/**
+ * Returns 1 if the entry holds exactly the given characters
+ */
+uint8_t isCachedText(const TextStrip *entry, const char str[], int textSize)
+{
+    int i;
+    if (entry->textSize != textSize)
+    {
+        return 0;
+    }
+    for (i = 0; i < textSize; i++)
+    {
+        if (entry->text[i] != str[i])
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ * Draws the given characters from the text cache, rasterising them on a miss
+ * Text too large for a strip is drawn directly and counted as a miss
+ */
+void drawCachedText(uint8_t x, uint8_t y, uint8_t offset, const char str[], int textSize,
+                    TextFont fontType)
+{
+    uint32_t hash = hashText(str, textSize);
+    TextStrip *entry, *victim = &textCache[0];
+    int i, width, banks;
+
+    textCacheClock++;
+    for (i = 0; i < TEXT_CACHE_ENTRIES; i++)
+    {
+        entry = &textCache[i];
+        if ((entry->banks != 0) && (entry->hash == hash)
+                && (entry->fontType == fontType) && (entry->offset == offset)
+                && isCachedText(entry, str, textSize))
+        {
+            textCacheHits++;
+            entry->lastUsed = textCacheClock;
+            drawBankedShape(x, y, 0, entry->strip, entry->width, entry->banks);
+            return;
+        }
+        if ((victim->banks != 0)
+                && ((entry->banks == 0)
+                        || ((uint16_t) (textCacheClock - entry->lastUsed)
+                                > (uint16_t) (textCacheClock - victim->lastUsed))))
+        {
+            victim = entry;
+        }
+    }
+
+    textCacheMisses++;
+    width = measureText(str, textSize, fontType);
+    banks = (offset + fonts[fontType]->height + 7) >> 3;
+    if ((width == 0) || (width > COLS) || (width * banks > TEXT_STRIP_BYTES)
+            || (textSize > TEXT_CACHE_CHARS))
+    {
+        drawText(x, y, offset, str, textSize, fontType);
+        return;
+    }
+
+    for (i = 0; i < width * banks; i++)
+    {
+        victim->strip[i] = 0x00;
+    }
+    rasterText(victim->strip, width, banks, 0, 0, offset, str, textSize, fontType);
+    for (i = 0; i < textSize; i++)
+    {
+        victim->text[i] = str[i];
+    }
+    victim->hash = hash;
+    victim->textSize = textSize;
+    victim->fontType = fontType;
+    victim->offset = offset;
+    victim->width = width;
+    victim->banks = banks;
+    victim->lastUsed = textCacheClock;
+    drawBankedShape(x, y, 0, victim->strip, width, banks);
+}
+
+void clearTextCache()
+{
+    int i;
+    for (i = 0; i < TEXT_CACHE_ENTRIES; i++)
+    {
+        textCache[i].banks = 0;
+    }
+}
+
+/**
+ * Left edge of a line of the given width
+ */
+int16_t getRevealLeft(const TextReveal *reveal, int16_t width)
+{
+    switch (reveal->align)
+    {
+    case ALIGN_CENTRE:
+        return (2 * reveal->anchor - width) / 2;
+    case ALIGN_RIGHT:
+        return reveal->anchor - width;
+    default:
+        return reveal->anchor;
+    }
+}
+
+/**
+ * Sets up a reveal with nothing shown
+ * The area the line will cover should already be clear
+ */
+void startTextReveal(TextReveal *reveal, uint8_t anchor, uint8_t y, uint8_t offset,
+                     const char str[], int textSize, TextFont fontType, TextAlign align)
+{
+    reveal->str = str;
+    reveal->textSize = (textSize > MAX_REVEAL_CHARS) ? MAX_REVEAL_CHARS : textSize;
+    reveal->fontType = fontType;
+    reveal->anchor = anchor;
+    reveal->y = y;
+    reveal->offset = offset;
+    reveal->align = align;
+    reveal->width = 0;
+    reveal->left = getRevealLeft(reveal, 0);
+    reveal->shown = 0;
+}
+
+/**
+ * Moves columns of the given banks along the frame buffer
+ */
+void moveColumns(uint8_t y, uint8_t banks, int from, int to, int count)
+{
+    uint8_t *row;
+    int i;
+    for (; banks > 0; banks--, y++)
+    {
+        if (y >= BANKS)
+        {
+            return;
+        }
+        row = frameBuffer[y];
+        if (to < from)
+        {
+            for (i = 0; i < count; i++)
+            {
+                if ((to + i >= 0) && (to + i < COLS) && (from + i >= 0)
+                        && (from + i < COLS))
+                {
+                    row[to + i] = row[from + i];
+                }
+            }
+        }
+        else if (to > from)
+        {
+            for (i = count - 1; i >= 0; i--)
+            {
+                if ((to + i >= 0) && (to + i < COLS) && (from + i >= 0)
+                        && (from + i < COLS))
+                {
+                    row[to + i] = row[from + i];
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Widens [*start, *end) to the columns a move fills from off the display,
+ * which hold nothing to move
+ */
+void addLostColumns(int from, int to, int count, int *start, int *end)
+{
+    int lost;
+    if ((count <= 0) || (from == to))
+    {
+        return;
+    }
+    if (from < 0)
+    {
+        lost = (-from < count) ? -from : count;
+        *start = (to < *start) ? to : *start;
+        *end = (to + lost > *end) ? to + lost : *end;
+    }
+    if (from + count > COLS)
+    {
+        lost = (COLS - from > 0) ? COLS - from : 0;
+        *start = (to + lost < *start) ? to + lost : *start;
+        *end = (to + count > *end) ? to + count : *end;
+    }
+}
+
+/**
+ * Draws again the visible characters other than i that cross [start, end)
+ */
+void redrawRevealColumns(const TextReveal *reveal, uint8_t i, int16_t left,
+                         uint8_t banks, int start, int end)
+{
+    const Font *font = fonts[reveal->fontType];
+    const Glyph *glyph;
+    uint8_t glyphBanks = (font->height + 7) >> 3;
+    uint8_t k, bank;
+    int x;
+
+    start = (start < 0) ? 0 : start;
+    end = (end > COLS) ? COLS : end;
+    for (bank = 0; (bank < banks) && (reveal->y + bank < BANKS); bank++)
+    {
+        for (x = start; x < end; x++)
+        {
+            frameBuffer[reveal->y + bank][x] = 0x00;
+        }
+    }
+    for (k = 0, x = left; (k < reveal->textSize) && (x < end); k++)
+    {
+        if ((k != i) && !(reveal->shown & (1UL << k)))
+        {
+            continue;
+        }
+        glyph = getGlyph(font, reveal->str[k]);
+        if ((k != i) && (x + glyph->width > start))
+        {
+            rasterShape(&frameBuffer[0][0], COLS, BANKS, x, reveal->y, reveal->offset,
+                        font->fontPtr + glyph->offset, glyph->width, glyphBanks);
+        }
+        x += glyph->width;
+    }
+}
+
+/**
+ * Shows character i: the visible characters either side of it slide apart
+ * to make room, then only its glyph is rasterised into the gap
+ * Columns that slide in from off the display are drawn again
+ */
+void revealChar(TextReveal *reveal, uint8_t i)
+{
+    const Font *font = fonts[reveal->fontType];
+    const Glyph *glyph = getGlyph(font, reveal->str[i]);
+    uint8_t banks = (reveal->offset + font->height + 7) >> 3;
+    uint8_t glyphBanks = (font->height + 7) >> 3;
+    int16_t width = reveal->width + glyph->width;
+    int16_t left = getRevealLeft(reveal, width);
+    int before = 0, after, gap, dirtyStart, dirtyEnd, x, lostStart = COLS, lostEnd = 0;
+    uint8_t k, bank;
+
+    for (k = 0; k < i; k++)
+    {
+        if (reveal->shown & (1UL << k))
+        {
+            before += getGlyph(font, reveal->str[k])->width;
+        }
+    }
+    after = reveal->width - before;
+    gap = left + before;
+
+    moveColumns(reveal->y, banks, reveal->left, left, before);
+    moveColumns(reveal->y, banks, reveal->left + before, gap + glyph->width, after);
+    addLostColumns(reveal->left, left, before, &lostStart, &lostEnd);
+    addLostColumns(reveal->left + before, gap + glyph->width, after, &lostStart, &lostEnd);
+    if (lostStart < lostEnd)
+    {
+        redrawRevealColumns(reveal, i, left, banks, lostStart, lostEnd);
+    }
+
+    for (bank = 0; (bank < banks) && (reveal->y + bank < BANKS); bank++)
+    {
+        for (x = (gap < 0) ? 0 : gap; (x < gap + glyph->width) && (x < COLS); x++)
+        {
+            frameBuffer[reveal->y + bank][x] = 0x00;
+        }
+    }
+    if (gap < COLS)
+    {
+        rasterShape(&frameBuffer[0][0], COLS, BANKS, gap, reveal->y, reveal->offset,
+                    font->fontPtr + glyph->offset, glyph->width, glyphBanks);
+    }
+
+    // Characters that did not move are not resent
+    dirtyStart = (left == reveal->left) ? gap : left;
+    dirtyEnd = (after == 0) ? gap + glyph->width : left + width;
+    if (dirtyStart < 0)
+    {
+        dirtyStart = 0;
+    }
+    if (dirtyEnd > COLS)
+    {
+        dirtyEnd = COLS;
+    }
+    for (bank = 0; (bank < banks) && (dirtyStart < dirtyEnd); bank++)
+    {
+        markDirty(dirtyStart, reveal->y + bank, dirtyEnd - dirtyStart);
+    }
+
+    reveal->left = left;
+    reveal->width = width;
+    reveal->shown |= 1UL << i;
+}
+
+/**
+ * Shows every character whose bit is set in chars
+ */
+void revealText(TextReveal *reveal, uint32_t chars)
+{
+    uint8_t i;
+    for (i = 0; i < reveal->textSize; i++)
+    {
+        if ((chars & (1UL << i)) && !(reveal->shown & (1UL << i)))
+        {
+            revealChar(reveal, i);
+        }
+    }
+}
+
+/**
+ * Typewriter effect: shows the first character that is still hidden
+ */
+void revealNextChar(TextReveal *reveal)
+{
+    uint8_t i;
+    for (i = 0; i < reveal->textSize; i++)
+    {
+        if (!(reveal->shown & (1UL << i)))
+        {
+            revealChar(reveal, i);
+            return;
+        }
+    }
+}
@@ -0,0 +1,84 @@
+#ifndef TEXT_H
+#define TEXT_H
+
+#include <stdint.h>
+#include "lcd.h"
+
+/**
+ * ==================================================================
+ * Text Measurement and Layout
+ * ==================================================================
+ */
+
+enum
+{
+    MAX_LAYOUT_CHARS = 64, MAX_LAYOUT_LINES = 6, // 48 rows / 8 pixel lines
+    TEXT_CACHE_ENTRIES = 4,
+    TEXT_CACHE_CHARS = 24, // Longer text is drawn without the cache
+    TEXT_STRIP_BYTES = 2 * COLS, // One line of 8 pixel text at any offset
+    MAX_REVEAL_CHARS = 32 // One bit per character
+};
+
+typedef enum
+{
+    ALIGN_LEFT, ALIGN_CENTRE, ALIGN_RIGHT
+} TextAlign;
+
+typedef struct TextBoxes {
+    uint8_t x, y; // Top left corner in pixels
+    uint8_t width, height;
+} TextBox;
+
+/**
+ * Result of layoutText
+ * Large enough that it should be declared static rather than on the stack
+ */
+typedef struct TextLayouts {
+    uint8_t y; // Top of the first line in pixels
+    uint8_t width; // Widest line in pixels
+    uint8_t height; // All lines in pixels
+    uint8_t lineHeight;
+    uint8_t numOfLines;
+    uint8_t numOfChars; // Characters that fit in the box
+    uint8_t lineStart[MAX_LAYOUT_LINES]; // Index of the first character of each line
+    uint8_t lineEnd[MAX_LAYOUT_LINES]; // One past the last character of each line
+    uint8_t charX[MAX_LAYOUT_CHARS]; // x of each character in pixels
+} TextLayout;
+
+/**
+ * A single line of text that appears a few characters at a time
+ * Only the columns that move or appear are redrawn; the line owns its banks
+ * between the leftmost and rightmost column it has covered
+ */
+typedef struct TextReveals {
+    const char *str;
+    uint8_t textSize;
+    uint8_t fontType;
+    uint8_t anchor; // Left edge, centre or right edge, depending on align
+    uint8_t y;
+    uint8_t offset;
+    uint8_t align;
+    int16_t left; // Left edge of the visible characters; may be off the display
+    int16_t width; // Visible characters in pixels
+    uint32_t shown; // Bit i is set once character i is visible
+} TextReveal;
+
+extern uint32_t textCacheHits;
+extern uint32_t textCacheMisses;
+
+/* ================================================================== */
+
+uint32_t hashText(const char str[], int textSize);
+int measureText(const char str[], int textSize, TextFont fontType);
+uint8_t layoutText(const char str[], int textSize, TextFont fontType,
+                   const TextBox *box, TextAlign align, TextLayout *layout);
+void drawTextLayout(const char str[], TextFont fontType, const TextLayout *layout);
+void drawCachedText(uint8_t x, uint8_t y, uint8_t offset, const char str[], int textSize,
+                    TextFont fontType);
+void clearTextCache();
+void startTextReveal(TextReveal *reveal, uint8_t anchor, uint8_t y, uint8_t offset,
+                     const char str[], int textSize, TextFont fontType, TextAlign align);
+void revealText(TextReveal *reveal, uint32_t chars);
+void revealNextChar(TextReveal *reveal);
+
+#endif // TEXT_H
@@ -0,0 +1,121 @@
+/**
+ * ==================================================================
+ * Tilemaps
+ * ==================================================================
+ *
+ * A level is a grid of tile indices kept in flash, with a tileset of
+ * 8x8 tiles. Tiles are one bank high and are drawn on tile boundaries,
+ * so each tile is copied straight into a bank of the frame buffer.
+ *
+ * The tile shown in each cell of the display is remembered, and only
+ * cells whose tile has changed are copied and marked dirty.
+ *
+ * ==================================================================
+ * ==================================================================
+ */
+
+#include "tilemap.h"
+#include "bundle.h"
+
+// Add levels here; their tiles and tilesets are in the asset bundle
+#include "Levels/demo.h"
+
+/**
+ * Every level, and the names of its tiles and its tileset in the asset bundle
+ * !!! Warning: If any levels are added, these arrays must change as well
+ */
+Level *const levels[numOfLevels] = { &demoLevel };
+const char *const levelAssets[numOfLevels][2] = { { "demoMap", "demoTiles" } };
+
+const uint8_t emptyTile[TILE_SIZE] = { 0 };
+
+uint8_t shownTiles[VIEW_ROWS][VIEW_COLUMNS];
+const uint8_t *shownTileset;
+uint16_t tilesDrawn; // Tiles copied into the frame buffer
+
+/**
+ * Points each level at its tiles and tileset, which are read in place from the asset bundle
+ * A level missing from the bundle is left empty
+ */
+void loadLevels()
+{
+    Level *level;
+    uint8_t i;
+    for (i = 0; i < numOfLevels; i++)
+    {
+        level = levels[i];
+        level->grid.tiles = getAssetData(findAsset(levelAssets[i][0]));
+        level->tileset = getAssetData(findAsset(levelAssets[i][1]));
+        if ((level->grid.tiles == 0) || (level->tileset == 0))
+        {
+            level->grid.columns = 0;
+            level->grid.rows = 0;
+            level->tileset = emptyTile;
+        }
+    }
+}
+
+/**
+ * Returns the tile in the cell; cells outside the level are empty
+ */
+uint8_t getTile(const Level *level, int16_t column, int16_t row)
+{
+    if ((column < 0) || (row < 0) || (column >= level->grid.columns)
+            || (row >= level->grid.rows))
+    {
+        return 0;
+    }
+    return level->grid.tiles[row * level->grid.columns + column];
+}
+
+/**
+ * Makes the next drawTilemap() draw every cell, after the frame buffer was changed by other means
+ */
+void forgetTilemap()
+{
+    uint8_t row, column;
+    for (row = 0; row < VIEW_ROWS; row++)
+    {
+        for (column = 0; column < VIEW_COLUMNS; column++)
+        {
+            shownTiles[row][column] = NO_TILE;
+        }
+    }
+}
+
+/**
+ * Shows the level with the given cell in the top left corner of the display
+ */
+void drawTilemap(const Level *level, int16_t column, int16_t row)
+{
+    uint8_t x, y, i, tile, width;
+    const uint8_t *source;
+    uint8_t *dest;
+
+    if (level->tileset != shownTileset)
+    {
+        forgetTilemap();
+        shownTileset = level->tileset;
+    }
+    for (y = 0; y < VIEW_ROWS; y++)
+    {
+        for (x = 0; x < VIEW_COLUMNS; x++)
+        {
+            tile = getTile(level, column + x, row + y);
+            if (tile == shownTiles[y][x])
+            {
+                continue;
+            }
+            shownTiles[y][x] = tile;
+            source = level->tileset + tile * TILE_SIZE;
+            dest = &frameBuffer[y][x * TILE_SIZE];
+            width = (x * TILE_SIZE + TILE_SIZE > COLS) ? COLS - x * TILE_SIZE : TILE_SIZE;
+            for (i = 0; i < width; i++)
+            {
+                dest[i] = source[i];
+            }
+            markDirty(x * TILE_SIZE, y, width);
+            tilesDrawn++;
+        }
+    }
+}
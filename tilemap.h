@@ -0,0 +1,42 @@
+#ifndef TILEMAP_H
+#define TILEMAP_H
+
+#include <stdint.h>
+#include "lcd.h"
+#include "collision.h"
+
+/**
+ * ==================================================================
+ * Tilemaps
+ * ==================================================================
+ */
+
+enum
+{
+    TILE_SIZE = 8, // One bank high, so tiles are copied without shifting
+    VIEW_COLUMNS = (COLS + TILE_SIZE - 1) / TILE_SIZE, // The last one is cut off
+    VIEW_ROWS = BANKS,
+    NO_TILE = 0xFF
+};
+
+typedef enum
+{
+    DEMO_LEVEL, numOfLevels
+} LevelName;
+
+typedef struct Levels {
+    TileGrid grid; // Tile indices, also used for collision
+    const uint8_t *tileset; // TILE_SIZE columns per tile
+} Level;
+
+extern Level *const levels[numOfLevels];
+extern uint16_t tilesDrawn;
+
+/* ================================================================== */
+
+void loadLevels();
+uint8_t getTile(const Level *level, int16_t column, int16_t row);
+void drawTilemap(const Level *level, int16_t column, int16_t row);
+void forgetTilemap();
+
+#endif // TILEMAP_H
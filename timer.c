@@ -1,13 +1,21 @@
-#include "tm4c123gh6pm.h"
 #include "timer.h"
 #include <stdint.h>
 
+#ifdef PART_TM4C123GH6PM
+
+#include "tm4c123gh6pm.h"
+
 #define RELOAD (16000 - 1) // N+1 clock pulses, where N is any value from 1 to 0x00FF.FFFF
 #define COUNT_NOT_ZERO ((NVIC_ST_CTRL_R & (1<<16)) == 0)
 #define ENABLE_SYSTICK (1<<0)
 #define CLK_SRC (1<<2) // System Clock
 #define INTEN (0<<1) // Interrupt is disabled
 
+#define TIMER_1 (1<<1)
+#define TAEN (1<<0) // Timer A Enable
+#define PERIODIC_MODE (0x2)
+#define TACDIR (1<<4) // Timer A counts up
+
 /**
  * Uses the integrated system timer, SysTick
  * Default bus clock is 16MHz
@@ -24,7 +32,7 @@ void initTimer()
 // time: number of ms to wait
 void wait_1ms(uint32_t time)
 {
-    int i;
+    uint32_t i;
     for (i = 0; i < time; i++)
     {
         NVIC_ST_CURRENT_R = 1;
@@ -35,9 +43,94 @@ void wait_1ms(uint32_t time)
 // time: number of seconds to wait
 void wait_1s(uint32_t time)
 {
-    int i;
+    uint32_t i;
+    for (i = 0; i < time; i++)
+    {
+        wait_1ms(1000);
+    }
+}
+
+/**
+ * Free running 32-bit count of bus clock cycles on Timer 1
+ * Wraps around every 268 seconds; compare times by subtracting them
+ */
+void initClock()
+{
+    SYSCTL_RCGCTIMER_R |= TIMER_1;
+    while ((SYSCTL_PRTIMER_R & TIMER_1) == 0)
+    {
+    }
+    TIMER1_CTL_R &= ~TAEN; // Disable while configuring
+    TIMER1_CFG_R = 0x0; // 32-bit timer
+    TIMER1_TAMR_R = PERIODIC_MODE | TACDIR;
+    TIMER1_TAILR_R = 0xFFFFFFFF;
+    TIMER1_CTL_R |= TAEN;
+}
+
+// Returns the number of bus clock cycles since initClock
+uint32_t getTime()
+{
+    return TIMER1_TAV_R;
+}
+
+uint32_t frameStart; // getTime() at the start of the current frame
+
+/**
+ * Waits until FRAME_MS after the previous frame started, so each pass of
+ * the game loop is one fixed step; a frame that ran late is not caught up
+ */
+void waitForFrame()
+{
+    uint32_t now;
+    do
+    {
+        now = getTime();
+    } while (now - frameStart < FRAME_MS * CYCLES_PER_MS);
+    frameStart = now;
+}
+
+#else
+
+#include <time.h>
+
+/**
+ * Host builds count processor time in bus clock cycles instead
+ */
+void initTimer()
+{
+}
+
+void wait_1ms(uint32_t time)
+{
+    uint32_t start = getTime();
+    while (getTime() - start < time * CYCLES_PER_MS)
+    {
+    }
+}
+
+void wait_1s(uint32_t time)
+{
+    uint32_t i;
     for (i = 0; i < time; i++)
     {
         wait_1ms(1000);
     }
 }
+
+void initClock()
+{
+}
+
+uint32_t getTime()
+{
+    return (uint32_t) ((uint64_t) clock() * CLOCK_HZ / CLOCKS_PER_SEC);
+}
+
+/**
+ * Host builds only replay, so frames run back to back
+ */
+void waitForFrame()
+{
+}
+
+#endif
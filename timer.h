@@ -3,8 +3,16 @@
 
 #include <stdint.h>
 
+#define CLOCK_HZ (16000000UL) // Default bus clock
+#define CYCLES_PER_MS (CLOCK_HZ / 1000)
+#define FRAME_MS (20) // Length of a game frame
+
 void initTimer();
 void wait_1ms(uint32_t time);
 void wait_1s(uint32_t time);
 
+void initClock();
+uint32_t getTime();
+void waitForFrame();
+
 #endif // TIMER_H
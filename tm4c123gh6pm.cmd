@@ -10,7 +10,8 @@
 
 MEMORY
 {
-    FLASH (RX) : origin = 0x00000000, length = 0x00040000
+    FLASH (RX) : origin = 0x00000000, length = 0x0003F800
+    REPLAY (R) : origin = 0x0003F800, length = 0x00000800 /* Saved input replay, see replay.c */
     SRAM (RWX) : origin = 0x20000000, length = 0x00008000
 }
 